@@ -0,0 +1,344 @@
+#pragma once
+
+#include "Math/Util.h"
+#include "Math/Simd.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define QMATH_BENCHMARK_TSC 1
+#else
+#define QMATH_BENCHMARK_TSC 0
+#endif
+
+#ifndef QUARTZMATH_VERSION
+#define QUARTZMATH_VERSION "unknown"
+#endif
+
+namespace Quartz
+{
+	namespace Benchmark
+	{
+		/*====================================================
+		|              QUARTZMATH BENCHMARK HARNESS          |
+		=====================================================*/
+
+		// A minimal stand-in for Google Benchmark. Each benchmark processes
+		// itemsPerRun items per call and is repeated until minTime seconds have
+		// passed. One item is one operation, so real_time / cpu_time are ns/op.
+		// Output (console table or JSON) follows Google Benchmark's layout so
+		// the same tooling can compare runs.
+		//
+		// bytes_per_cycle uses the time stamp counter, which ticks at the
+		// nominal (not boosted) frequency on current x86 CPUs. It is omitted on
+		// targets without a TSC.
+
+		/** Keep the compiler from discarding value */
+		template<typename Type>
+		inline void DoNotOptimize(const Type& value)
+		{
+		#if defined(_MSC_VER)
+			const volatile void* sink = &value;
+			(void)sink;
+			_ReadWriteBarrier();
+		#else
+			asm volatile("" : : "r,m"(value) : "memory");
+		#endif
+		}
+
+		/** Keep the compiler from discarding or reordering memory writes */
+		inline void ClobberMemory()
+		{
+		#if defined(_MSC_VER)
+			_ReadWriteBarrier();
+		#else
+			asm volatile("" : : : "memory");
+		#endif
+		}
+
+		inline uInt64 ReadCycles()
+		{
+		#if QMATH_BENCHMARK_TSC
+			return __rdtsc();
+		#else
+			return 0;
+		#endif
+		}
+
+		struct BenchmarkEntry
+		{
+			std::string				name;
+			uSize					itemsPerRun;
+			uSize					bytesPerItem;
+			std::function<void()>	run;
+		};
+
+		struct BenchmarkResult
+		{
+			std::string	name;
+			uInt64		iterations;
+			double		realTime;
+			double		cpuTime;
+			double		itemsPerSecond;
+			double		bytesPerSecond;
+			double		bytesPerCycle;
+		};
+
+		inline std::vector<BenchmarkEntry>& Registry()
+		{
+			static std::vector<BenchmarkEntry> entries;
+			return entries;
+		}
+
+		/** Register a benchmark: run() processes itemsPerRun items of bytesPerItem bytes each */
+		inline void Register(const std::string& name, uSize itemsPerRun, uSize bytesPerItem, std::function<void()> run)
+		{
+			Registry().push_back({ name, itemsPerRun, bytesPerItem, std::move(run) });
+		}
+
+		inline BenchmarkResult Run(const BenchmarkEntry& entry, double minTime)
+		{
+			using Clock = std::chrono::steady_clock;
+
+			// Warm caches and branch predictors
+			entry.run();
+			ClobberMemory();
+
+			uInt64 runs = 1;
+
+			for (;;)
+			{
+				const std::clock_t cpuStart		= std::clock();
+				const uInt64 cyclesStart		= ReadCycles();
+				const Clock::time_point start	= Clock::now();
+
+				for (uInt64 i = 0; i < runs; i++)
+				{
+					entry.run();
+					ClobberMemory();
+				}
+
+				const double seconds	= std::chrono::duration<double>(Clock::now() - start).count();
+				const uInt64 cycles		= ReadCycles() - cyclesStart;
+				const double cpuSeconds	= (double)(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+				if (seconds >= minTime || runs >= (1ull << 40))
+				{
+					const double items = (double)runs * (double)entry.itemsPerRun;
+					const double bytes = items * (double)entry.bytesPerItem;
+
+					BenchmarkResult result;
+					result.name				= entry.name;
+					result.iterations		= (uInt64)items;
+					result.realTime			= seconds * 1e9 / items;
+					result.cpuTime			= cpuSeconds * 1e9 / items;
+					result.itemsPerSecond	= items / seconds;
+					result.bytesPerSecond	= bytes / seconds;
+					result.bytesPerCycle	= cycles ? bytes / (double)cycles : 0.0;
+					return result;
+				}
+
+				// Aim 40% past minTime so the next attempt usually suffices
+				const double scale = seconds > 0.0 ? minTime * 1.4 / seconds : 10.0;
+				runs = (uInt64)((double)runs * Clamp(2.0, 100.0, scale));
+			}
+		}
+
+		inline const char* SimdName()
+		{
+		#if QMATH_AVX512
+			return "AVX512";
+		#elif QMATH_AVX2 && QMATH_FMA
+			return "AVX2+FMA";
+		#elif QMATH_AVX2
+			return "AVX2";
+		#elif QMATH_AVX
+			return "AVX";
+		#elif QMATH_SSE2
+			return "SSE2";
+		#else
+			return "scalar";
+		#endif
+		}
+
+		inline std::string CompilerName()
+		{
+		#if defined(__clang__)
+			return std::string("clang ") + __clang_version__;
+		#elif defined(__GNUC__)
+			return std::string("gcc ") + __VERSION__;
+		#elif defined(_MSC_VER)
+			return "msvc " + std::to_string(_MSC_FULL_VER);
+		#else
+			return "unknown";
+		#endif
+		}
+
+		inline void WriteJson(FILE* file, const std::vector<BenchmarkResult>& results)
+		{
+			char date[64];
+			const std::time_t now = std::time(nullptr);
+			std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+			std::fprintf(file, "{\n");
+			std::fprintf(file, "  \"context\": {\n");
+			std::fprintf(file, "    \"date\": \"%s\",\n", date);
+			std::fprintf(file, "    \"library_version\": \"%s\",\n", QUARTZMATH_VERSION);
+			std::fprintf(file, "    \"compiler\": \"%s\",\n", CompilerName().c_str());
+			std::fprintf(file, "    \"simd\": \"%s\",\n", SimdName());
+			std::fprintf(file, "    \"simd_width\": %d,\n", QMATH_SIMD_WIDTH);
+			std::fprintf(file, "    \"fma\": %s,\n", QMATH_FMA ? "true" : "false");
+			std::fprintf(file, "    \"fast_sqrt_2nd_pass\": %s,\n", QMATH_USE_FAST_SQRT_2ND_PASS ? "true" : "false");
+			std::fprintf(file, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+			std::fprintf(file, "    \"cycle_counter\": \"%s\"\n", QMATH_BENCHMARK_TSC ? "tsc" : "none");
+			std::fprintf(file, "  },\n");
+			std::fprintf(file, "  \"benchmarks\": [\n");
+
+			for (uSize i = 0; i < results.size(); i++)
+			{
+				const BenchmarkResult& result = results[i];
+
+				std::fprintf(file, "    {\n");
+				std::fprintf(file, "      \"name\": \"%s\",\n", result.name.c_str());
+				std::fprintf(file, "      \"run_type\": \"iteration\",\n");
+				std::fprintf(file, "      \"iterations\": %llu,\n", (unsigned long long)result.iterations);
+				std::fprintf(file, "      \"real_time\": %.6f,\n", result.realTime);
+				std::fprintf(file, "      \"cpu_time\": %.6f,\n", result.cpuTime);
+				std::fprintf(file, "      \"time_unit\": \"ns\",\n");
+				std::fprintf(file, "      \"items_per_second\": %.6e,\n", result.itemsPerSecond);
+
+				if (QMATH_BENCHMARK_TSC)
+				{
+					std::fprintf(file, "      \"bytes_per_second\": %.6e,\n", result.bytesPerSecond);
+					std::fprintf(file, "      \"bytes_per_cycle\": %.6f\n", result.bytesPerCycle);
+				}
+				else
+				{
+					std::fprintf(file, "      \"bytes_per_second\": %.6e\n", result.bytesPerSecond);
+				}
+
+				std::fprintf(file, "    }%s\n", i + 1 < results.size() ? "," : "");
+			}
+
+			std::fprintf(file, "  ]\n");
+			std::fprintf(file, "}\n");
+		}
+
+		inline void PrintConsoleHeader()
+		{
+			std::printf("QuartzMath %s | %s | simd %s (width %d)\n",
+				QUARTZMATH_VERSION, CompilerName().c_str(), SimdName(), QMATH_SIMD_WIDTH);
+			std::printf("%-48s %12s %14s %12s\n", "Benchmark", "ns/op", "ops/s", "bytes/cycle");
+			std::printf("%s\n", std::string(89, '-').c_str());
+		}
+
+		inline void PrintConsole(const BenchmarkResult& result)
+		{
+			std::printf("%-48s %12.3f %14.4e %12.3f\n",
+				result.name.c_str(), result.realTime, result.itemsPerSecond, result.bytesPerCycle);
+			std::fflush(stdout);
+		}
+
+		/**
+		 * Run every registered benchmark. Flags:
+		 *   --benchmark_filter=<substring>	only run benchmarks whose name contains substring
+		 *   --benchmark_min_time=<seconds>	minimum time per benchmark (default 0.2)
+		 *   --benchmark_format=console|json	stdout format (default console)
+		 *   --benchmark_out=<file>			also write JSON to file
+		 */
+		inline int Main(int argc, char** argv)
+		{
+			std::string filter;
+			std::string outPath;
+			double minTime	= 0.2;
+			bool json		= false;
+
+			for (int i = 1; i < argc; i++)
+			{
+				const std::string arg = argv[i];
+				const std::string::size_type split = arg.find('=');
+				const std::string key	= arg.substr(0, split);
+				const std::string value	= split == std::string::npos ? "" : arg.substr(split + 1);
+
+				if (key == "--benchmark_filter")
+				{
+					filter = value;
+				}
+				else if (key == "--benchmark_min_time")
+				{
+					minTime = std::atof(value.c_str());
+				}
+				else if (key == "--benchmark_format")
+				{
+					json = value == "json";
+				}
+				else if (key == "--benchmark_out")
+				{
+					outPath = value;
+				}
+				else
+				{
+					std::fprintf(stderr, "Unknown argument: %s\n", arg.c_str());
+					return 1;
+				}
+			}
+
+			if (!json)
+			{
+				PrintConsoleHeader();
+			}
+
+			std::vector<BenchmarkResult> results;
+
+			for (const BenchmarkEntry& entry : Registry())
+			{
+				if (!filter.empty() && entry.name.find(filter) == std::string::npos)
+				{
+					continue;
+				}
+
+				results.push_back(Run(entry, minTime));
+
+				if (!json)
+				{
+					PrintConsole(results.back());
+				}
+			}
+
+			if (json)
+			{
+				WriteJson(stdout, results);
+			}
+
+			if (!outPath.empty())
+			{
+				FILE* file = std::fopen(outPath.c_str(), "w");
+
+				if (!file)
+				{
+					std::fprintf(stderr, "Could not open %s\n", outPath.c_str());
+					return 1;
+				}
+
+				WriteJson(file, results);
+				std::fclose(file);
+			}
+
+			return 0;
+		}
+	}
+}
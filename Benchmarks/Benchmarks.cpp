@@ -0,0 +1,1205 @@
+#include "Benchmark.h"
+#include "Math/Math.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace Quartz;
+using namespace Quartz::Benchmark;
+
+// Working sets are sized to stay in L1/L2 so results measure arithmetic
+// throughput rather than memory bandwidth.
+static constexpr uSize BENCH_COUNT		= 1024;
+static constexpr uSize BENCH_TILE_SIZE	= 64;
+
+/** Deterministic inputs in [lo, hi) */
+struct BenchRandom
+{
+	uInt64 state = 0x853c49e6748fea9bull;
+
+	float Next(float lo, float hi)
+	{
+		state = state * 6364136223846793005ull + 1442695040888963407ull;
+		return lo + (hi - lo) * (float)(state >> 40) * (1.0f / 16777216.0f);
+	}
+
+	Vec3f NextVec3(float lo, float hi)
+	{
+		return Vec3f(Next(lo, hi), Next(lo, hi), Next(lo, hi));
+	}
+
+	Vec4f NextVec4(float lo, float hi)
+	{
+		return Vec4f(Next(lo, hi), Next(lo, hi), Next(lo, hi), Next(lo, hi));
+	}
+
+	Quatf NextQuat()
+	{
+		return Quatf(NextVec3(-1.0f, 1.0f).Normalized(), Next(-3.14159265f, 3.14159265f));
+	}
+
+	Mat4f NextTransform()
+	{
+		return Mat4f().SetScale(NextVec3(0.5f, 2.0f)) *
+			Mat4f().SetRotation(NextQuat()) *
+			Mat4f().SetTranslation(NextVec3(-100.0f, 100.0f));
+	}
+};
+
+static void RegisterMatrixBenchmarks()
+{
+	static std::vector<Mat4f> matsA, matsB, matsOut;
+	static std::vector<Affine3f> affinesA, affinesB, rigids, affinesOut;
+	static std::vector<Vec4f> vecs, vecsOut;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		matsA.push_back(random.NextTransform());
+		matsB.push_back(random.NextTransform());
+		vecs.push_back(random.NextVec4(-10.0f, 10.0f));
+
+		affinesA.push_back(Affine3f(matsA[i]));
+		affinesB.push_back(Affine3f(matsB[i]));
+		rigids.push_back(Affine3f().SetTRS(random.NextVec3(-100.0f, 100.0f), random.NextQuat(), Vec3f(1.0f)));
+	}
+
+	matsOut.resize(BENCH_COUNT);
+	affinesOut.resize(BENCH_COUNT);
+	vecsOut.resize(BENCH_COUNT);
+
+	Register("Mat4f/Multiply", BENCH_COUNT, 3 * sizeof(Mat4f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			matsOut[i] = matsA[i] * matsB[i];
+		}
+	});
+
+	Register("Mat4f/Inverse", BENCH_COUNT, 2 * sizeof(Mat4f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			matsOut[i] = matsA[i].Inverse();
+		}
+	});
+
+	Register("Mat4f/Transposed", BENCH_COUNT, 2 * sizeof(Mat4f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			matsOut[i] = matsA[i].Transposed();
+		}
+	});
+
+	Register("Mat4f/MultiplyVec4", BENCH_COUNT, 2 * sizeof(Vec4f), []
+	{
+		const Mat4f mat = matsA[0];
+
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			vecsOut[i] = mat * vecs[i];
+		}
+	});
+
+	Register("Affine3f/Multiply", BENCH_COUNT, 3 * sizeof(Affine3f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			affinesOut[i] = affinesA[i] * affinesB[i];
+		}
+	});
+
+	Register("Affine3f/Inverse", BENCH_COUNT, 2 * sizeof(Affine3f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			affinesOut[i] = affinesA[i].Inverse();
+		}
+	});
+
+	Register("Affine3f/InverseRigid", BENCH_COUNT, 2 * sizeof(Affine3f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			affinesOut[i] = rigids[i].InverseRigid();
+		}
+	});
+}
+
+static void RegisterTransformBenchmarks()
+{
+	static std::vector<Vec3f> points, pointsOut;
+	static Vec3fSoA soaPoints, soaOut;
+	static Mat4f mat;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		points.push_back(random.NextVec3(-100.0f, 100.0f));
+	}
+
+	pointsOut.resize(BENCH_COUNT);
+	soaPoints	= Vec3fSoA(points);
+	soaOut		= Vec3fSoA(BENCH_COUNT);
+	mat			= random.NextTransform();
+
+	Register("TransformPoints/Scalar", BENCH_COUNT, 2 * sizeof(Vec3f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			pointsOut[i] = mat * points[i];
+		}
+	});
+
+	Register("TransformPoints/Batch", BENCH_COUNT, 2 * sizeof(Vec3f), []
+	{
+		TransformPoints(mat, points.data(), pointsOut.data(), BENCH_COUNT);
+	});
+
+	Register("TransformPoints/SoA", BENCH_COUNT, 2 * sizeof(Vec3f), []
+	{
+		TransformPoints(mat, soaPoints, soaOut);
+	});
+}
+
+static void RegisterHierarchyBenchmarks()
+{
+	static constexpr uSize nodeCount = 16 * BENCH_COUNT;
+
+	static TransformHierarchy hierarchy;
+	static std::vector<Transform> transforms, transformsOut;
+	static std::vector<Affine3f> affines;
+	static std::vector<Mat4f> mats;
+
+	BenchRandom random;
+
+	hierarchy.Reserve(nodeCount);
+
+	// Shallow chains: each node hangs off one of the previous 16 nodes, 1 in 32 is a root
+	for (uSize i = 0; i < nodeCount; i++)
+	{
+		const Transform local(random.NextVec3(-1.0f, 1.0f), random.NextQuat(), random.NextVec3(0.9f, 1.1f));
+		const uSize parentOffset = 1 + (uSize)random.Next(0.0f, 16.0f);
+		const bool root = i < parentOffset || random.Next(0.0f, 32.0f) < 1.0f;
+
+		hierarchy.Add(local, root ? TransformHierarchy::NO_PARENT : (uInt32)(i - parentOffset));
+	}
+
+	hierarchy.Update();
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		transforms.push_back(hierarchy.GetLocal((uInt32)i));
+	}
+
+	affines.resize(BENCH_COUNT);
+	mats.resize(BENCH_COUNT);
+	transformsOut.resize(BENCH_COUNT);
+
+	Register("ComposeTRS/ThreeMatrices", BENCH_COUNT, sizeof(Transform) + sizeof(Mat4f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			const Transform& transform = transforms[i];
+			mats[i] =
+				Mat4f().SetScale(transform.scale) *
+				Mat4f().SetRotation(transform.rotation) *
+				Mat4f().SetTranslation(transform.position);
+		}
+	});
+
+	Register("ComposeTRS/Scalar", BENCH_COUNT, sizeof(Transform) + sizeof(Mat4f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			mats[i] = transforms[i].GetMatrix();
+		}
+	});
+
+	Register("ComposeTRS/Batch", BENCH_COUNT, sizeof(Transform) + sizeof(Mat4f), []
+	{
+		ComposeTRS(transforms.data(), mats.data(), BENCH_COUNT);
+	});
+
+	Register("DecomposeTRS/Scalar", BENCH_COUNT, sizeof(Transform) + sizeof(Mat4f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			Transform& transform = transformsOut[i];
+			mats[i].DecomposeTRS(transform.position, transform.rotation, transform.scale);
+		}
+	});
+
+	Register("DecomposeTRS/Batch", BENCH_COUNT, sizeof(Transform) + sizeof(Mat4f), []
+	{
+		DecomposeTRS(mats.data(), transformsOut.data(), BENCH_COUNT);
+	});
+
+	Register("ComposeAffine/Scalar", BENCH_COUNT, sizeof(Transform) + sizeof(Affine3f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			affines[i] = transforms[i].GetAffine();
+		}
+	});
+
+	Register("ComposeAffine/Batch", BENCH_COUNT, sizeof(Transform) + sizeof(Affine3f), []
+	{
+		ComposeAffine(transforms.data(), affines.data(), BENCH_COUNT);
+	});
+
+	Register("Hierarchy/UpdateAll", nodeCount, sizeof(Transform) + 2 * sizeof(Affine3f), []
+	{
+		for (uSize i = 0; i < nodeCount; i++)
+		{
+			hierarchy.MarkDirty((uInt32)i);
+		}
+
+		hierarchy.Update();
+	});
+
+	// Items are all nodes, so ns/op shows the per-node cost of a sparse update
+	Register("Hierarchy/Update1Percent", nodeCount, sizeof(Transform) + 2 * sizeof(Affine3f), []
+	{
+		for (uSize i = 0; i < nodeCount; i += 100)
+		{
+			hierarchy.MarkDirty((uInt32)i);
+		}
+
+		hierarchy.Update();
+	});
+}
+
+static void RegisterRotationBenchmarks()
+{
+	static std::vector<Vec3f> euler;
+	static std::vector<Quatf> quats;
+	static std::vector<Mat4f> mats;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		euler.push_back(random.NextVec3(-3.14159265f, 3.14159265f));
+	}
+
+	quats.resize(BENCH_COUNT);
+	mats.resize(BENCH_COUNT);
+
+	Register("EulerToQuat/Scalar", BENCH_COUNT, sizeof(Vec3f) + sizeof(Quatf), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			quats[i].SetEuler(euler[i]);
+		}
+	});
+
+	Register("EulerToQuat/Batch", BENCH_COUNT, sizeof(Vec3f) + sizeof(Quatf), []
+	{
+		EulerToQuat(euler.data(), quats.data(), BENCH_COUNT);
+	});
+
+	Register("QuatToMat4/Scalar", BENCH_COUNT, sizeof(Quatf) + sizeof(Mat4f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			mats[i].SetRotation(quats[i]);
+		}
+	});
+
+	Register("QuatToMat4/Batch", BENCH_COUNT, sizeof(Quatf) + sizeof(Mat4f), []
+	{
+		QuatToMat4(quats.data(), mats.data(), BENCH_COUNT);
+	});
+
+	Register("EulerToMat4/Scalar", BENCH_COUNT, sizeof(Vec3f) + sizeof(Mat4f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			mats[i].SetRotation(euler[i]);
+		}
+	});
+
+	Register("EulerToMat4/Batch", BENCH_COUNT, sizeof(Vec3f) + sizeof(Mat4f), []
+	{
+		EulerToMat4(euler.data(), mats.data(), BENCH_COUNT);
+	});
+}
+
+static void RegisterBlendBenchmarks()
+{
+	static std::vector<Quatf> from;
+	static std::vector<Quatf> to;
+	static std::vector<Quatf> out;
+	static std::vector<float> weights;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		from.push_back(random.NextQuat());
+		to.push_back(random.NextQuat());
+		weights.push_back(random.Next(0.0f, 1.0f));
+	}
+
+	out.resize(BENCH_COUNT);
+
+	Register("Blend/Nlerp/Scalar", BENCH_COUNT, 3 * sizeof(Quatf) + sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			out[i] = Nlerp(from[i], to[i], weights[i]);
+		}
+	});
+
+	Register("Blend/Nlerp/Batch", BENCH_COUNT, 3 * sizeof(Quatf) + sizeof(float), []
+	{
+		Nlerp(from.data(), to.data(), weights.data(), out.data(), BENCH_COUNT);
+	});
+
+	Register("Blend/Slerp/Scalar", BENCH_COUNT, 3 * sizeof(Quatf) + sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			out[i] = Slerp(from[i], to[i], weights[i]);
+		}
+	});
+
+	Register("Blend/SlerpFast/Scalar", BENCH_COUNT, 3 * sizeof(Quatf) + sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			out[i] = SlerpFast(from[i], to[i], weights[i]);
+		}
+	});
+
+	Register("Blend/Slerp/Batch", BENCH_COUNT, 3 * sizeof(Quatf) + sizeof(float), []
+	{
+		Slerp(from.data(), to.data(), weights.data(), out.data(), BENCH_COUNT);
+	});
+}
+
+static void RegisterSkinningBenchmarks()
+{
+	static constexpr uSize BONE_COUNT = 64;
+
+	static std::vector<DualQuatf> dualQuats;
+	static std::vector<Affine3f> matrices;
+	static std::vector<uInt32> boneIndices;
+	static std::vector<float> boneWeights;
+	static Vec3fSoA positions, normals, positionsOut, normalsOut;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BONE_COUNT; i++)
+	{
+		const Quatf rotation = random.NextQuat();
+		const Vec3f translation = random.NextVec3(-10.0f, 10.0f);
+
+		dualQuats.push_back(DualQuatf(rotation, translation));
+		matrices.push_back(Affine3f().SetTRS(translation, rotation, Vec3f(1.0f, 1.0f, 1.0f)));
+	}
+
+	std::vector<Vec3f> vecs;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		vecs.push_back(random.NextVec3(-1.0f, 1.0f));
+
+		float sum = 0.0f;
+
+		for (uSize k = 0; k < SKIN_INFLUENCES; k++)
+		{
+			boneIndices.push_back((uInt32)random.Next(0.0f, (float)BONE_COUNT));
+			boneWeights.push_back(random.Next(0.0f, 1.0f));
+			sum += boneWeights.back();
+		}
+
+		for (uSize k = 0; k < SKIN_INFLUENCES; k++)
+		{
+			boneWeights[i * SKIN_INFLUENCES + k] /= sum;
+		}
+	}
+
+	positions		= Vec3fSoA(vecs);
+	normals			= Vec3fSoA(vecs);
+	positionsOut	= Vec3fSoA(BENCH_COUNT);
+	normalsOut		= Vec3fSoA(BENCH_COUNT);
+
+	constexpr uSize influenceBytes = SKIN_INFLUENCES * (sizeof(uInt32) + sizeof(float));
+
+	Register("Skin/Linear", BENCH_COUNT, 2 * sizeof(Vec3f) + influenceBytes, []
+	{
+		SkinLinear(matrices.data(), boneIndices.data(), boneWeights.data(), positions, positionsOut);
+	});
+
+	Register("Skin/DualQuaternion", BENCH_COUNT, 2 * sizeof(Vec3f) + influenceBytes, []
+	{
+		SkinDualQuaternion(dualQuats.data(), boneIndices.data(), boneWeights.data(), positions, positionsOut);
+	});
+
+	Register("SkinNormals/Linear", BENCH_COUNT, 4 * sizeof(Vec3f) + influenceBytes, []
+	{
+		SkinLinear(matrices.data(), boneIndices.data(), boneWeights.data(), positions, normals, positionsOut, normalsOut);
+	});
+
+	Register("SkinNormals/DualQuaternion", BENCH_COUNT, 4 * sizeof(Vec3f) + influenceBytes, []
+	{
+		SkinDualQuaternion(dualQuats.data(), boneIndices.data(), boneWeights.data(), positions, normals, positionsOut, normalsOut);
+	});
+}
+
+static void RegisterCullingBenchmarks()
+{
+	static Frustum frustum;
+	static std::vector<Bounds3f> bounds;
+	static std::vector<Vec4f> spheres;
+	static std::vector<uInt32> visibleIndices;
+	static std::vector<uInt32> visibleMask;
+	static std::vector<uInt8> planeCache;
+	static Vec3fSoA centers, extents;
+
+	BenchRandom random;
+
+	frustum.Set(Mat4f().SetTranslation(Vec3f(-3.0f, 2.0f, -5.0f)) *
+		Mat4f().SetRotation(Vec3f(0.0f, 1.0f, 0.0f), 0.7f) *
+		Mat4f().SetPerspective(1.2f, 16.0f / 9.0f, 0.5f, 200.0f));
+
+	std::vector<Vec3f> centerVecs, extentVecs;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		const Vec3f center = random.NextVec3(-200.0f, 200.0f);
+		const Vec3f extent = random.NextVec3(0.1f, 5.0f);
+
+		bounds.push_back(Bounds3f(center - extent, center + extent));
+		spheres.push_back(Vec4f(center.x, center.y, center.z, extent.x));
+		centerVecs.push_back(center);
+		extentVecs.push_back(extent);
+	}
+
+	centers	= Vec3fSoA(centerVecs);
+	extents	= Vec3fSoA(extentVecs);
+
+	visibleIndices.resize(BENCH_COUNT);
+	visibleMask.resize((BENCH_COUNT + 31) / 32);
+	planeCache.resize(BENCH_COUNT);
+
+	Register("Cull/Bounds/Scalar", BENCH_COUNT, sizeof(Bounds3f), []
+	{
+		uSize visibleCount = 0;
+
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			visibleIndices[visibleCount] = (uInt32)i;
+			visibleCount += frustum.IntersectsBounds(bounds[i]);
+		}
+	});
+
+	Register("Cull/Bounds/ScalarHint", BENCH_COUNT, sizeof(Bounds3f) + 1, []
+	{
+		uSize visibleCount = 0;
+
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			visibleIndices[visibleCount] = (uInt32)i;
+			visibleCount += frustum.IntersectsBounds(bounds[i], planeCache[i]);
+		}
+	});
+
+	Register("Cull/Bounds/Batch", BENCH_COUNT, sizeof(Bounds3f), []
+	{
+		CullBounds(frustum, bounds.data(), BENCH_COUNT, visibleIndices.data());
+	});
+
+	Register("Cull/Bounds/BatchHint", BENCH_COUNT, sizeof(Bounds3f) + 1, []
+	{
+		CullBounds(frustum, bounds.data(), BENCH_COUNT, visibleIndices.data(), planeCache.data());
+	});
+
+	Register("Cull/Bounds/BatchMask", BENCH_COUNT, sizeof(Bounds3f), []
+	{
+		CullBoundsMask(frustum, bounds.data(), BENCH_COUNT, visibleMask.data());
+	});
+
+	Register("Cull/Bounds/SoA", BENCH_COUNT, 2 * sizeof(Vec3f), []
+	{
+		CullBounds(frustum, centers, extents, visibleIndices.data());
+	});
+
+	Register("Cull/Spheres/Scalar", BENCH_COUNT, sizeof(Vec4f), []
+	{
+		uSize visibleCount = 0;
+
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			const Vec4f& sphere = spheres[i];
+			visibleIndices[visibleCount] = (uInt32)i;
+			visibleCount += frustum.IntersectsSphere(Vec3f(sphere.x, sphere.y, sphere.z), sphere.w);
+		}
+	});
+
+	Register("Cull/Spheres/Batch", BENCH_COUNT, sizeof(Vec4f), []
+	{
+		CullSpheres(frustum, spheres.data(), BENCH_COUNT, visibleIndices.data());
+	});
+}
+
+static void RegisterBvhBenchmarks()
+{
+	static constexpr uSize QUERY_COUNT = 256;
+
+	static std::vector<Bounds3f> bounds, moved;
+	static std::vector<Ray3f> rays;
+	static std::vector<Bounds3f> boxes;
+	static std::vector<Vec3f> points;
+	static std::vector<uInt32> results;
+	static std::vector<float> hits;
+	static Bvh3 bvh, refitBvh;
+	static Bvh3x4 bvh4;
+	static Bvh3x8 bvh8;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		const Vec3f center = random.NextVec3(-100.0f, 100.0f);
+		const Vec3f extent = random.NextVec3(0.5f, 4.0f);
+		const Vec3f offset = random.NextVec3(-1.0f, 1.0f);
+
+		bounds.push_back(Bounds3f(center - extent, center + extent));
+		moved.push_back(Bounds3f(center - extent + offset, center + extent + offset));
+	}
+
+	for (uSize i = 0; i < QUERY_COUNT; i++)
+	{
+		const Vec3f center = random.NextVec3(-100.0f, 100.0f);
+		const Vec3f extent = random.NextVec3(2.0f, 10.0f);
+
+		rays.push_back(Ray3f(random.NextVec3(-120.0f, 120.0f), random.NextVec3(-1.0f, 1.0f)));
+		boxes.push_back(Bounds3f(center - extent, center + extent));
+		points.push_back(random.NextVec3(-120.0f, 120.0f));
+	}
+
+	hits.resize(QUERY_COUNT);
+
+	bvh.Build(bounds.data(), BENCH_COUNT);
+	refitBvh.Build(bounds.data(), BENCH_COUNT);
+	bvh4.Build(bvh);
+	bvh8.Build(bvh);
+
+	Register("Bvh/Build", BENCH_COUNT, sizeof(Bounds3f), []
+	{
+		refitBvh.Build(bounds.data(), BENCH_COUNT);
+	});
+
+	Register("Bvh/Refit", BENCH_COUNT, sizeof(Bounds3f), []
+	{
+		refitBvh.Refit(moved.data());
+	});
+
+	Register("Bvh/Raycast/Linear", QUERY_COUNT, sizeof(Ray3f), []
+	{
+		for (uSize i = 0; i < QUERY_COUNT; i++)
+		{
+			const BvhRay bvhRay(rays[i]);
+			float tMax = BVH_INFINITY;
+
+			for (const Bounds3f& box : bounds)
+			{
+				tMax = Min(tMax, bvhRay.Enter(box, tMax));
+			}
+
+			hits[i] = tMax;
+		}
+	});
+
+	Register("Bvh/Raycast/Binary", QUERY_COUNT, sizeof(Ray3f), []
+	{
+		for (uSize i = 0; i < QUERY_COUNT; i++)
+		{
+			float tMax = BVH_INFINITY;
+			uInt32 hit;
+			bvh.Raycast(rays[i], tMax, hit);
+			hits[i] = tMax;
+		}
+	});
+
+	Register("Bvh/Raycast/Wide4", QUERY_COUNT, sizeof(Ray3f), []
+	{
+		for (uSize i = 0; i < QUERY_COUNT; i++)
+		{
+			float tMax = BVH_INFINITY;
+			uInt32 hit;
+			bvh4.Raycast(rays[i], tMax, hit);
+			hits[i] = tMax;
+		}
+	});
+
+	Register("Bvh/Raycast/Wide8", QUERY_COUNT, sizeof(Ray3f), []
+	{
+		for (uSize i = 0; i < QUERY_COUNT; i++)
+		{
+			float tMax = BVH_INFINITY;
+			uInt32 hit;
+			bvh8.Raycast(rays[i], tMax, hit);
+			hits[i] = tMax;
+		}
+	});
+
+	Register("Bvh/Overlap/Binary", QUERY_COUNT, sizeof(Bounds3f), []
+	{
+		for (const Bounds3f& box : boxes)
+		{
+			bvh.QueryOverlap(box, results);
+		}
+	});
+
+	Register("Bvh/Overlap/Wide4", QUERY_COUNT, sizeof(Bounds3f), []
+	{
+		for (const Bounds3f& box : boxes)
+		{
+			bvh4.QueryOverlap(box, results);
+		}
+	});
+
+	Register("Bvh/Nearest/Binary", QUERY_COUNT, sizeof(Vec3f), []
+	{
+		for (uSize i = 0; i < QUERY_COUNT; i++)
+		{
+			float distanceSquared = BVH_INFINITY;
+			uInt32 nearest;
+			bvh.QueryNearest(points[i], distanceSquared, nearest);
+			hits[i] = distanceSquared;
+		}
+	});
+
+	Register("Bvh/Nearest/Wide4", QUERY_COUNT, sizeof(Vec3f), []
+	{
+		for (uSize i = 0; i < QUERY_COUNT; i++)
+		{
+			float distanceSquared = BVH_INFINITY;
+			uInt32 nearest;
+			bvh4.QueryNearest(points[i], distanceSquared, nearest);
+			hits[i] = distanceSquared;
+		}
+	});
+}
+
+static void RegisterCompressionBenchmarks()
+{
+	static std::vector<Transform> transforms;
+	static std::vector<PackedTransform32> packed;
+	static TransformQuantization quantization(Bounds3f(Vec3f(-100.0f, -100.0f, -100.0f), Vec3f(100.0f, 100.0f, 100.0f)), 0.0f, 4.0f);
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		const float scale = random.Next(0.5f, 2.0f);
+		transforms.push_back(Transform(random.NextVec3(-100.0f, 100.0f), random.NextQuat(), Vec3f(scale, scale, scale)));
+	}
+
+	packed.resize(BENCH_COUNT);
+
+	Register("PackTransforms/Scalar", BENCH_COUNT, sizeof(Transform) + sizeof(PackedTransform32), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			packed[i].Pack(transforms[i], quantization);
+		}
+	});
+
+	Register("PackTransforms/Batch", BENCH_COUNT, sizeof(Transform) + sizeof(PackedTransform32), []
+	{
+		PackTransforms(transforms.data(), quantization, packed.data(), BENCH_COUNT);
+	});
+
+	Register("UnpackTransforms/Scalar", BENCH_COUNT, sizeof(Transform) + sizeof(PackedTransform32), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			transforms[i] = packed[i].Unpack(quantization);
+		}
+	});
+
+	Register("UnpackTransforms/Batch", BENCH_COUNT, sizeof(Transform) + sizeof(PackedTransform32), []
+	{
+		UnpackTransforms(packed.data(), quantization, transforms.data(), BENCH_COUNT);
+	});
+}
+
+static void RegisterHalfBenchmarks()
+{
+	static std::vector<Vec4f> vectors;
+	static std::vector<Vec4h> halves;
+	static std::vector<Vec4bf> bfloats;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		vectors.push_back(random.NextVec4(-100.0f, 100.0f));
+	}
+
+	halves.resize(BENCH_COUNT);
+	bfloats.resize(BENCH_COUNT);
+
+	Register("Vec4h/FromFloat/Scalar", BENCH_COUNT, sizeof(Vec4f) + sizeof(Vec4h), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			halves[i] = Vec4h(vectors[i]);
+		}
+	});
+
+	Register("Vec4h/FromFloat/Batch", BENCH_COUNT, sizeof(Vec4f) + sizeof(Vec4h), []
+	{
+		Convert(vectors.data(), halves.data(), BENCH_COUNT);
+	});
+
+	Register("Vec4h/ToFloat/Scalar", BENCH_COUNT, sizeof(Vec4f) + sizeof(Vec4h), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			vectors[i] = Vec4f(halves[i]);
+		}
+	});
+
+	Register("Vec4h/ToFloat/Batch", BENCH_COUNT, sizeof(Vec4f) + sizeof(Vec4h), []
+	{
+		Convert(halves.data(), vectors.data(), BENCH_COUNT);
+	});
+
+	Register("Vec4bf/FromFloat/Batch", BENCH_COUNT, sizeof(Vec4f) + sizeof(Vec4bf), []
+	{
+		Convert(vectors.data(), bfloats.data(), BENCH_COUNT);
+	});
+
+	Register("Vec4bf/ToFloat/Batch", BENCH_COUNT, sizeof(Vec4f) + sizeof(Vec4bf), []
+	{
+		Convert(bfloats.data(), vectors.data(), BENCH_COUNT);
+	});
+}
+
+static void RegisterFixedBenchmarks()
+{
+	static std::vector<Matrix4<Fixed32>> matsA, matsB, matsOut;
+	static std::vector<Vector3<Fixed32>> vecs, vecsOut;
+	static std::vector<Quaternion<Fixed32>> quats;
+	static std::vector<Fixed32> angles, sines, cosines;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		const Mat4f matA = random.NextTransform();
+		const Mat4f matB = random.NextTransform();
+		const Vec3f vec = random.NextVec3(-10.0f, 10.0f);
+		const Quatf quat = random.NextQuat();
+
+		Matrix4<Fixed32> fixedA, fixedB;
+
+		for (uSize element = 0; element < 16; element++)
+		{
+			fixedA.e[element] = matA.e[element];
+			fixedB.e[element] = matB.e[element];
+		}
+
+		matsA.push_back(fixedA);
+		matsB.push_back(fixedB);
+		vecs.push_back(Vector3<Fixed32>(vec.x, vec.y, vec.z));
+		quats.push_back(Quaternion<Fixed32>(quat.x, quat.y, quat.z, quat.w));
+		angles.push_back(random.Next(-100.0f, 100.0f));
+	}
+
+	matsOut.resize(BENCH_COUNT);
+	vecsOut.resize(BENCH_COUNT);
+	sines.resize(BENCH_COUNT);
+	cosines.resize(BENCH_COUNT);
+
+	Register("Fixed32/Mat4/Multiply", BENCH_COUNT, 3 * sizeof(Matrix4<Fixed32>), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			matsOut[i] = matsA[i] * matsB[i];
+		}
+	});
+
+	Register("Fixed32/Vec3/Normalized", BENCH_COUNT, 2 * sizeof(Vector3<Fixed32>), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			vecsOut[i] = vecs[i].Normalized();
+		}
+	});
+
+	Register("Fixed32/Quat/MultiplyVec3", BENCH_COUNT,
+		sizeof(Quaternion<Fixed32>) + 2 * sizeof(Vector3<Fixed32>), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			vecsOut[i] = quats[i] * vecs[i];
+		}
+	});
+
+	Register("Fixed32/SinCos", BENCH_COUNT, 3 * sizeof(Fixed32), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			SinCos(angles[i], sines[i], cosines[i]);
+		}
+	});
+}
+
+static void RegisterVectorBenchmarks()
+{
+	static std::vector<Vec3f> vecs, vecsOut;
+	static std::vector<Quatf> quats;
+	static Vec3fSoA soaVecs, soaOut;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		vecs.push_back(random.NextVec3(-10.0f, 10.0f));
+		quats.push_back(random.NextQuat());
+	}
+
+	vecsOut.resize(BENCH_COUNT);
+	soaVecs	= Vec3fSoA(vecs);
+	soaOut	= Vec3fSoA(BENCH_COUNT);
+
+	Register("Vec3f/Normalized/Fast", BENCH_COUNT, 2 * sizeof(Vec3f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			vecsOut[i] = vecs[i].Normalized<Precision::Fast>();
+		}
+	});
+
+	Register("Vec3f/Normalized/Balanced", BENCH_COUNT, 2 * sizeof(Vec3f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			vecsOut[i] = vecs[i].Normalized<Precision::Balanced>();
+		}
+	});
+
+	Register("Vec3f/Normalized/Exact", BENCH_COUNT, 2 * sizeof(Vec3f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			vecsOut[i] = vecs[i].Normalized<Precision::Exact>();
+		}
+	});
+
+	Register("Vec3f/Normalized/SoA", BENCH_COUNT, 2 * sizeof(Vec3f), []
+	{
+		Normalize(soaVecs, soaOut);
+	});
+
+	Register("Quatf/MultiplyVec3", BENCH_COUNT, sizeof(Quatf) + 2 * sizeof(Vec3f), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			vecsOut[i] = quats[i] * vecs[i];
+		}
+	});
+}
+
+static void RegisterUtilBenchmarks()
+{
+	static std::vector<float> values, valuesOut;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		values.push_back(random.Next(1e-3f, 1e3f));
+	}
+
+	valuesOut.resize(BENCH_COUNT);
+
+	Register("FastInvsereSquare/Scalar", BENCH_COUNT, 2 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			valuesOut[i] = FastInvsereSquare(values[i]);
+		}
+	});
+
+	Register("FastInvsereSquare/Batch", BENCH_COUNT, 2 * sizeof(float), []
+	{
+		FastInvsereSquare(values.data(), valuesOut.data(), BENCH_COUNT);
+	});
+
+	Register("InverseSqrt/Balanced", BENCH_COUNT, 2 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			valuesOut[i] = InverseSqrt<Precision::Balanced>(values[i]);
+		}
+	});
+
+	Register("InverseSqrt/Exact", BENCH_COUNT, 2 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			valuesOut[i] = InverseSqrt<Precision::Exact>(values[i]);
+		}
+	});
+}
+
+static void RegisterTrigBenchmarks()
+{
+	static std::vector<float> angles, values, sinOut, cosOut;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		angles.push_back(random.Next(-10.0f, 10.0f));
+		values.push_back(random.Next(1e-3f, 1e3f));
+	}
+
+	sinOut.resize(BENCH_COUNT);
+	cosOut.resize(BENCH_COUNT);
+
+	Register("SinCos/Libm", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			sinOut[i] = sinf(angles[i]);
+			cosOut[i] = cosf(angles[i]);
+		}
+	});
+
+	Register("SinCos/Scalar", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			SinCos(angles[i], sinOut[i], cosOut[i]);
+		}
+	});
+
+	Register("SinCos/Batch", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i += QMATH_SIMD_WIDTH)
+		{
+			Simd::FloatN sin, cos;
+			SinCos(Simd::FloatN::Load(angles.data() + i), sin, cos);
+			sin.Store(sinOut.data() + i);
+			cos.Store(cosOut.data() + i);
+		}
+	});
+
+	Register("Atan2/Libm", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			sinOut[i] = atan2f(angles[i], values[i]);
+		}
+	});
+
+	Register("Atan2/Batch", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i += QMATH_SIMD_WIDTH)
+		{
+			Atan2(Simd::FloatN::Load(angles.data() + i), Simd::FloatN::Load(values.data() + i)).Store(sinOut.data() + i);
+		}
+	});
+
+	Register("Exp2/Libm", BENCH_COUNT, 2 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			sinOut[i] = exp2f(angles[i]);
+		}
+	});
+
+	Register("Exp2/Batch", BENCH_COUNT, 2 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i += QMATH_SIMD_WIDTH)
+		{
+			Exp2(Simd::FloatN::Load(angles.data() + i)).Store(sinOut.data() + i);
+		}
+	});
+
+	Register("Log2/Libm", BENCH_COUNT, 2 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			sinOut[i] = log2f(values[i]);
+		}
+	});
+
+	Register("Log2/Batch", BENCH_COUNT, 2 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i += QMATH_SIMD_WIDTH)
+		{
+			Log2(Simd::FloatN::Load(values.data() + i)).Store(sinOut.data() + i);
+		}
+	});
+}
+
+template<NoiseGradient gradient>
+static void RegisterPerlinBenchmarks(const char* mode)
+{
+	static std::vector<float> xs, ys, out;
+	static const NoiseContext context(1, gradient);
+
+	if (xs.empty())
+	{
+		BenchRandom random;
+
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			xs.push_back(random.Next(-1000.0f, 1000.0f));
+			ys.push_back(random.Next(-1000.0f, 1000.0f));
+		}
+
+		out.resize(BENCH_TILE_SIZE * BENCH_TILE_SIZE);
+	}
+
+	const std::string prefix = std::string("PerlinNoise2D/") + mode;
+
+	Register(prefix + "/Scalar", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			out[i] = PerlinNoise2D<gradient>(context, xs[i], ys[i]);
+		}
+	});
+
+	Register(prefix + "/Batch", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		PerlinNoise2D<gradient>(context, xs.data(), ys.data(), out.data(), BENCH_COUNT);
+	});
+
+	Register(prefix + "/Tile", BENCH_TILE_SIZE * BENCH_TILE_SIZE, sizeof(float), []
+	{
+		GenerateNoiseTile2D<gradient>(context, Vec2f(-3.1f, 7.7f), Vec2f(0.05f, 0.05f),
+			BENCH_TILE_SIZE, BENCH_TILE_SIZE, out.data());
+	});
+}
+
+static void RegisterNoiseBenchmarks()
+{
+	RegisterPerlinBenchmarks<NoiseGradient::Angle>("Angle");
+	RegisterPerlinBenchmarks<NoiseGradient::Table>("Table");
+
+	static std::vector<float> xs, ys, zs, ws, out;
+	static std::vector<float> field;
+	static const NoiseContext context(1);
+	static const FractalParams fractal(FractalType::FBm, 6);
+
+	constexpr uSize fieldSize = 1024;
+
+	BenchRandom random;
+
+	for (uSize i = 0; i < BENCH_COUNT; i++)
+	{
+		xs.push_back(random.Next(-1000.0f, 1000.0f));
+		ys.push_back(random.Next(-1000.0f, 1000.0f));
+		zs.push_back(random.Next(-1000.0f, 1000.0f));
+		ws.push_back(random.Next(-1000.0f, 1000.0f));
+	}
+
+	out.resize(BENCH_COUNT);
+	field.resize(fieldSize * fieldSize);
+
+	Register("FractalNoise2D/Scalar", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			out[i] = FractalNoise2D(context, fractal, xs[i], ys[i]);
+		}
+	});
+
+	Register("FractalNoise2D/Batch", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		FractalNoise2D(context, fractal, xs.data(), ys.data(), out.data(), BENCH_COUNT);
+	});
+
+	Register("PerlinNoise3D/Scalar", BENCH_COUNT, 4 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			out[i] = PerlinNoise3D(context, xs[i], ys[i], zs[i]);
+		}
+	});
+
+	Register("PerlinNoise3D/Batch", BENCH_COUNT, 4 * sizeof(float), []
+	{
+		PerlinNoise3D(context, xs.data(), ys.data(), zs.data(), out.data(), BENCH_COUNT);
+	});
+
+	Register("SimplexNoise2D/Scalar", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			out[i] = SimplexNoise2D(context, xs[i], ys[i]);
+		}
+	});
+
+	Register("SimplexNoise2D/Batch", BENCH_COUNT, 3 * sizeof(float), []
+	{
+		SimplexNoise2D(context, xs.data(), ys.data(), out.data(), BENCH_COUNT);
+	});
+
+	Register("SimplexNoise3D/Scalar", BENCH_COUNT, 4 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			out[i] = SimplexNoise3D(context, xs[i], ys[i], zs[i]);
+		}
+	});
+
+	Register("SimplexNoise3D/Batch", BENCH_COUNT, 4 * sizeof(float), []
+	{
+		SimplexNoise3D(context, xs.data(), ys.data(), zs.data(), out.data(), BENCH_COUNT);
+	});
+
+	Register("SimplexNoise4D/Scalar", BENCH_COUNT, 5 * sizeof(float), []
+	{
+		for (uSize i = 0; i < BENCH_COUNT; i++)
+		{
+			out[i] = SimplexNoise4D(context, xs[i], ys[i], zs[i], ws[i]);
+		}
+	});
+
+	Register("SimplexNoise4D/Batch", BENCH_COUNT, 5 * sizeof(float), []
+	{
+		SimplexNoise4D(context, xs.data(), ys.data(), zs.data(), ws.data(), out.data(), BENCH_COUNT);
+	});
+
+	Register("GenerateNoiseField/1024x1024", fieldSize * fieldSize, sizeof(float), []
+	{
+		GenerateNoiseField(context, Vec2f(0.0f, 0.0f), Vec2f(0.05f, 0.05f), fieldSize, fieldSize, field.data());
+	});
+}
+
+int main(int argc, char** argv)
+{
+	RegisterMatrixBenchmarks();
+	RegisterTransformBenchmarks();
+	RegisterHierarchyBenchmarks();
+	RegisterRotationBenchmarks();
+	RegisterBlendBenchmarks();
+	RegisterSkinningBenchmarks();
+	RegisterCullingBenchmarks();
+	RegisterBvhBenchmarks();
+	RegisterCompressionBenchmarks();
+	RegisterHalfBenchmarks();
+	RegisterFixedBenchmarks();
+	RegisterVectorBenchmarks();
+	RegisterUtilBenchmarks();
+	RegisterTrigBenchmarks();
+	RegisterNoiseBenchmarks();
+
+	return Quartz::Benchmark::Main(argc, argv);
+}
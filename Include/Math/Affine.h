@@ -0,0 +1,397 @@
+#pragma once
+
+#include "Vector.h"
+#include "Quaternion.h"
+#include "Matrix.h"
+
+namespace Quartz
+{
+	/*====================================================
+	|                QUARTZMATH MATRIX4X3                |
+	=====================================================*/
+
+	// Affine transform stored as the first three columns of a Matrix4: rows
+	// 0-2 hold the linear part (scale, rotation, shear) and row 3 the
+	// translation, with the implied last column (0, 0, 0, 1). Element names,
+	// row vector convention and multiplication order match Matrix4, so
+	// Matrix4x3(a) * Matrix4x3(b) == Matrix4x3(a * b) for affine a and b.
+	//
+	// Composition is 36 multiplies (Matrix4: 64), Inverse inverts the 3x3
+	// part only and InverseRigid is a transpose for rotation + translation.
+
+	template<typename IntType>
+	struct Matrix4x3
+	{
+		union
+		{
+			// Row major: accessed m[row][column]
+			IntType m[4][3];
+
+			// Row major: accessed e[row * 3 + column]
+			IntType e[12];
+
+			// Row major
+			struct
+			{
+				IntType m00, m01, m02; // Left
+				IntType m10, m11, m12; // Up
+				IntType m20, m21, m22; // Forward
+				IntType m30, m31, m32; // Position
+			};
+		};
+
+		/** Construct an uninitialized Matrix4x3 */
+		constexpr Matrix4x3() {};
+
+		/** Construct a Matrix4x3 from values */
+		constexpr Matrix4x3(
+			IntType m00, IntType m01, IntType m02,
+			IntType m10, IntType m11, IntType m12,
+			IntType m20, IntType m21, IntType m22,
+			IntType m30, IntType m31, IntType m32)
+		{
+			this->m00 = m00; this->m01 = m01; this->m02 = m02;
+			this->m10 = m10; this->m11 = m11; this->m12 = m12;
+			this->m20 = m20; this->m21 = m21; this->m22 = m22;
+			this->m30 = m30; this->m31 = m31; this->m32 = m32;
+		}
+
+		/** Construct a Matrix4x3 from the affine part of a Matrix4, the last column is dropped */
+		explicit constexpr Matrix4x3(const Matrix4<IntType>& mat4)
+		{
+			m00 = mat4.m00; m01 = mat4.m01; m02 = mat4.m02;
+			m10 = mat4.m10; m11 = mat4.m11; m12 = mat4.m12;
+			m20 = mat4.m20; m21 = mat4.m21; m22 = mat4.m22;
+			m30 = mat4.m30; m31 = mat4.m31; m32 = mat4.m32;
+		}
+
+		/** Get the equivalent Matrix4 */
+		constexpr Matrix4<IntType> ToMatrix4() const
+		{
+			return Matrix4<IntType>(
+				m00, m01, m02, 0,
+				m10, m11, m12, 0,
+				m20, m21, m22, 0,
+				m30, m31, m32, 1);
+		}
+
+		/** Set to the identity matrix */
+		constexpr Matrix4x3& SetIdentity()
+		{
+			m00 = 1; m01 = 0; m02 = 0;
+			m10 = 0; m11 = 1; m12 = 0;
+			m20 = 0; m21 = 0; m22 = 1;
+			m30 = 0; m31 = 0; m32 = 0;
+			return *this;
+		}
+
+		/** Set to a translation matrix */
+		constexpr Matrix4x3& SetTranslation(const Vector3<IntType>& translation)
+		{
+			SetIdentity();
+			m30 = translation.x;
+			m31 = translation.y;
+			m32 = translation.z;
+			return *this;
+		}
+
+		/** Set to a rotation matrix */
+		constexpr Matrix4x3& SetRotation(const Quaternion<IntType>& rotation)
+		{
+			return SetTRS(Vector3<IntType>(0, 0, 0), rotation, Vector3<IntType>(1, 1, 1));
+		}
+
+		/** Set to a scale matrix */
+		constexpr Matrix4x3& SetScale(const Vector3<IntType>& scale)
+		{
+			m00 = scale.x; m01 = 0; m02 = 0;
+			m10 = 0; m11 = scale.y; m12 = 0;
+			m20 = 0; m21 = 0; m22 = scale.z;
+			m30 = 0; m31 = 0; m32 = 0;
+			return *this;
+		}
+
+		/** Set to scale, then rotation, then translation. Same as SetScale * SetRotation * SetTranslation */
+		constexpr Matrix4x3& SetTRS(const Vector3<IntType>& translation,
+			const Quaternion<IntType>& rotation, const Vector3<IntType>& scale)
+		{
+			IntType qx = rotation.x;
+			IntType qy = rotation.y;
+			IntType qz = rotation.z;
+			IntType qw = rotation.w;
+
+			// Rows of the rotation matrix scaled by the matching scale axis
+			m00 = (1.0f - 2.0f * ((qy * qy) + (qz * qz))) * scale.x;
+			m01 = (		  2.0f * ((qx * qy) + (qz * qw))) * scale.x;
+			m02 = (		  2.0f * ((qx * qz) - (qy * qw))) * scale.x;
+
+			m10 = (		  2.0f * ((qx * qy) - (qz * qw))) * scale.y;
+			m11 = (1.0f - 2.0f * ((qx * qx) + (qz * qz))) * scale.y;
+			m12 = (		  2.0f * ((qy * qz) + (qx * qw))) * scale.y;
+
+			m20 = (		  2.0f * ((qx * qz) + (qy * qw))) * scale.z;
+			m21 = (		  2.0f * ((qy * qz) - (qx * qw))) * scale.z;
+			m22 = (1.0f - 2.0f * ((qx * qx) + (qy * qy))) * scale.z;
+
+			m30 = translation.x;
+			m31 = translation.y;
+			m32 = translation.z;
+
+			return *this;
+		}
+
+		/** Split into translation, rotation and scale, the inverse of SetTRS. Same as Matrix4::DecomposeTRS */
+		constexpr void DecomposeTRS(Vector3<IntType>& translation,
+			Quaternion<IntType>& rotation, Vector3<IntType>& scale) const
+		{
+			ToMatrix4().DecomposeTRS(translation, rotation, scale);
+		}
+
+		/** Get the IntType determinant of the linear part */
+		constexpr IntType Determinant() const
+		{
+			return
+				  m00 * (m11 * m22 - m12 * m21)
+				- m01 * (m10 * m22 - m12 * m20)
+				+ m02 * (m10 * m21 - m11 * m20);
+		}
+
+		/** Invert into result, returns false and leaves result untouched if the linear part is singular */
+		constexpr bool TryInverse(Matrix4x3& result) const
+		{
+			// Adjugate of the linear part
+			IntType c00 = m11 * m22 - m12 * m21;
+			IntType c01 = m02 * m21 - m01 * m22;
+			IntType c02 = m01 * m12 - m02 * m11;
+
+			IntType c10 = m12 * m20 - m10 * m22;
+			IntType c11 = m00 * m22 - m02 * m20;
+			IntType c12 = m02 * m10 - m00 * m12;
+
+			IntType c20 = m10 * m21 - m11 * m20;
+			IntType c21 = m01 * m20 - m00 * m21;
+			IntType c22 = m00 * m11 - m01 * m10;
+
+			IntType det = m00 * c00 + m01 * c10 + m02 * c20;
+
+			if (det == 0)
+			{
+				return false;
+			}
+
+			IntType invdet = 1.0f / det;
+
+			result.m00 = c00 * invdet; result.m01 = c01 * invdet; result.m02 = c02 * invdet;
+			result.m10 = c10 * invdet; result.m11 = c11 * invdet; result.m12 = c12 * invdet;
+			result.m20 = c20 * invdet; result.m21 = c21 * invdet; result.m22 = c22 * invdet;
+
+			result.m30 = -(m30 * result.m00 + m31 * result.m10 + m32 * result.m20);
+			result.m31 = -(m30 * result.m01 + m31 * result.m11 + m32 * result.m21);
+			result.m32 = -(m30 * result.m02 + m31 * result.m12 + m32 * result.m22);
+
+			return true;
+		}
+
+		/** Get the inverse of an affine matrix, singular matrices return the identity */
+		constexpr Matrix4x3 Inverse() const
+		{
+			Matrix4x3 result;
+
+			if (!TryInverse(result))
+			{
+				result.SetIdentity();
+			}
+
+			return result;
+		}
+
+		/** Get the inverse of a rotation + translation matrix (orthonormal linear part) */
+		constexpr Matrix4x3 InverseRigid() const
+		{
+			Matrix4x3 result;
+
+			result.m00 = m00; result.m01 = m10; result.m02 = m20;
+			result.m10 = m01; result.m11 = m11; result.m12 = m21;
+			result.m20 = m02; result.m21 = m12; result.m22 = m22;
+
+			result.m30 = -(m30 * m00 + m31 * m01 + m32 * m02);
+			result.m31 = -(m30 * m10 + m31 * m11 + m32 * m12);
+			result.m32 = -(m30 * m20 + m31 * m21 + m32 * m22);
+
+			return result;
+		}
+
+		/** Get the origin vector */
+		constexpr Vector3<IntType> GetTranslation() const
+		{
+			return Vector3<IntType>(m30, m31, m32);
+		}
+
+		/** Get the scaled right vector */
+		constexpr Vector3<IntType> GetScaledRight() const
+		{
+			return Vector3<IntType>(m00, m01, m02);
+		}
+
+		/** Get the scaled up vector */
+		constexpr Vector3<IntType> GetScaledUp() const
+		{
+			return Vector3<IntType>(m10, m11, m12);
+		}
+
+		/** Get the scaled forward vector */
+		constexpr Vector3<IntType> GetScaledForward() const
+		{
+			return Vector3<IntType>(m20, m21, m22);
+		}
+
+		/** Get a component by index */
+		constexpr IntType& operator[](uSize index)
+		{
+			return e[index];
+		}
+
+		/** Get a component by index */
+		constexpr IntType operator[](uSize index) const
+		{
+			return e[index];
+		}
+
+		/** Multiply a matrix to this */
+		constexpr Matrix4x3 operator*(const Matrix4x3& mat) const
+		{
+			Matrix4x3 result;
+
+			result.m00 = m00 * mat.m00 + m01 * mat.m10 + m02 * mat.m20;
+			result.m01 = m00 * mat.m01 + m01 * mat.m11 + m02 * mat.m21;
+			result.m02 = m00 * mat.m02 + m01 * mat.m12 + m02 * mat.m22;
+
+			result.m10 = m10 * mat.m00 + m11 * mat.m10 + m12 * mat.m20;
+			result.m11 = m10 * mat.m01 + m11 * mat.m11 + m12 * mat.m21;
+			result.m12 = m10 * mat.m02 + m11 * mat.m12 + m12 * mat.m22;
+
+			result.m20 = m20 * mat.m00 + m21 * mat.m10 + m22 * mat.m20;
+			result.m21 = m20 * mat.m01 + m21 * mat.m11 + m22 * mat.m21;
+			result.m22 = m20 * mat.m02 + m21 * mat.m12 + m22 * mat.m22;
+
+			result.m30 = m30 * mat.m00 + m31 * mat.m10 + m32 * mat.m20 + mat.m30;
+			result.m31 = m30 * mat.m01 + m31 * mat.m11 + m32 * mat.m21 + mat.m31;
+			result.m32 = m30 * mat.m02 + m31 * mat.m12 + m32 * mat.m22 + mat.m32;
+
+			return result;
+		}
+
+		/** Multiply this by a matrix */
+		constexpr void operator*=(const Matrix4x3& mat)
+		{
+			*this = *this * mat;
+		}
+
+		/** Multiply a Vector3<IntType> to this (w = 1) */
+		constexpr Vector3<IntType> operator*(const Vector3<IntType>& vec3) const
+		{
+			Vector3<IntType> result;
+
+			result.x = m00 * vec3.x + m10 * vec3.y + m20 * vec3.z + m30;
+			result.y = m01 * vec3.x + m11 * vec3.y + m21 * vec3.z + m31;
+			result.z = m02 * vec3.x + m12 * vec3.y + m22 * vec3.z + m32;
+
+			return result;
+		}
+
+		/** Transform a direction (w = 0) */
+		constexpr Vector3<IntType> TransformDirection(const Vector3<IntType>& vec3) const
+		{
+			Vector3<IntType> result;
+
+			result.x = m00 * vec3.x + m10 * vec3.y + m20 * vec3.z;
+			result.y = m01 * vec3.x + m11 * vec3.y + m21 * vec3.z;
+			result.z = m02 * vec3.x + m12 * vec3.y + m22 * vec3.z;
+
+			return result;
+		}
+
+		/** Check if two matrices are equal */
+		constexpr bool operator==(const Matrix4x3& mat) const
+		{
+			for (uSize i = 0; i < 12; i++)
+			{
+				if (e[i] != mat.e[i])
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		/** Check if two matrices are not equal */
+		constexpr bool operator!=(const Matrix4x3& mat) const
+		{
+			return !(*this == mat);
+		}
+	};
+
+#if QMATH_SSE2
+
+	/*====================================================
+	|             QUARTZMATH MATRIX4X3 (SIMD)            |
+	=====================================================*/
+
+	// The twelve floats are moved as three non-overlapping groups of four, so
+	// loads and stores never straddle each other (no store forwarding stalls).
+	// Rows of the right operand are shuffled out of the groups with a spare
+	// fourth lane, which only ever reaches the discarded fourth result lane.
+
+	template<>
+	inline Matrix4x3<float> Matrix4x3<float>::operator*(const Matrix4x3<float>& mat) const
+	{
+		Matrix4x3<float> result;
+
+		const __m128 right0 = Simd::Load4(mat.e + 0);	// m00 m01 m02 m10
+		const __m128 right1 = Simd::Load4(mat.e + 4);	// m11 m12 m20 m21
+		const __m128 right2 = Simd::Load4(mat.e + 8);	// m22 m30 m31 m32
+
+		const __m128 split	= _mm_shuffle_ps(right0, right1, _MM_SHUFFLE(1, 0, 3, 3));
+		const __m128 row0	= right0;
+		const __m128 row1	= _mm_shuffle_ps(split, split, _MM_SHUFFLE(3, 3, 2, 1));
+		const __m128 row2	= _mm_shuffle_ps(right1, right2, _MM_SHUFFLE(0, 0, 3, 2));
+		const __m128 row3	= _mm_shuffle_ps(right2, right2, _MM_SHUFFLE(3, 3, 2, 1));
+
+		// Scalar broadcasts of the left operand: loads rather than shuffles with AVX
+		__m128 out0 = _mm_mul_ps(_mm_set1_ps(m00), row0);
+		out0 = Simd::MulAdd4(_mm_set1_ps(m01), row1, out0);
+		out0 = Simd::MulAdd4(_mm_set1_ps(m02), row2, out0);
+
+		__m128 out1 = _mm_mul_ps(_mm_set1_ps(m10), row0);
+		out1 = Simd::MulAdd4(_mm_set1_ps(m11), row1, out1);
+		out1 = Simd::MulAdd4(_mm_set1_ps(m12), row2, out1);
+
+		__m128 out2 = _mm_mul_ps(_mm_set1_ps(m20), row0);
+		out2 = Simd::MulAdd4(_mm_set1_ps(m21), row1, out2);
+		out2 = Simd::MulAdd4(_mm_set1_ps(m22), row2, out2);
+
+		// Row 3 has an implied w = 1
+		__m128 out3 = Simd::MulAdd4(_mm_set1_ps(m30), row0, row3);
+		out3 = Simd::MulAdd4(_mm_set1_ps(m31), row1, out3);
+		out3 = Simd::MulAdd4(_mm_set1_ps(m32), row2, out3);
+
+		// Pack the four xyz rows back into three groups of four
+		const __m128 join0 = _mm_shuffle_ps(out0, out1, _MM_SHUFFLE(0, 0, 2, 2));
+		const __m128 join2 = _mm_shuffle_ps(out2, out3, _MM_SHUFFLE(0, 0, 2, 2));
+
+		Simd::Store4(result.e + 0, _mm_shuffle_ps(out0, join0, _MM_SHUFFLE(2, 0, 1, 0)));
+		Simd::Store4(result.e + 4, _mm_shuffle_ps(out1, out2, _MM_SHUFFLE(1, 0, 2, 1)));
+		Simd::Store4(result.e + 8, _mm_shuffle_ps(join2, out3, _MM_SHUFFLE(2, 1, 2, 0)));
+
+		return result;
+	}
+
+#endif // QMATH_SSE2
+
+	typedef Matrix4x3<float>	Mat4x3f;
+	typedef Matrix4x3<double>	Mat4x3d;
+
+	typedef Matrix4x3<float>	Affine3f;
+	typedef Matrix4x3<double>	Affine3d;
+}
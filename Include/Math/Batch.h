@@ -0,0 +1,1132 @@
+#pragma once
+
+#include "Simd.h"
+#include "FastTrig.h"
+#include "Vector.h"
+#include "VectorSoA.h"
+#include "Quaternion.h"
+#include "DualQuaternion.h"
+#include "Matrix.h"
+#include "Affine.h"
+#include "Transform.h"
+
+namespace Quartz
+{
+	/*====================================================
+	|             QUARTZMATH BATCH TRANSFORMS            |
+	=====================================================*/
+
+	// Batch transforms read blocks of QMATH_SIMD_MAX_WIDTH vectors into local
+	// lanes, transform them with Simd::FloatN and write them back. A block is
+	// fully read before it is written, so in and out may be the same buffer
+	// (with the same stride). Partially overlapping buffers are not supported.
+	//
+	// Strides are in bytes, so positions can be read from and written to
+	// interleaved vertex buffers directly.
+
+	enum class BatchTransformMode
+	{
+		Point,		// w = 1, affine: column 3 of the matrix is ignored
+		Direction,	// w = 0, translation is ignored
+		Projective	// w = 1, full 4x4 then divide by w
+	};
+
+	template<BatchTransformMode mode>
+	inline void BatchTransformVec3(const Mat4f& mat4,
+		const void* in, uSize inStride, void* out, uSize outStride, uSize count)
+	{
+		using Simd::FloatN;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float x[QMATH_SIMD_MAX_WIDTH];
+		alignas(QMATH_SIMD_ALIGNMENT) float y[QMATH_SIMD_MAX_WIDTH];
+		alignas(QMATH_SIMD_ALIGNMENT) float z[QMATH_SIMD_MAX_WIDTH];
+
+		const FloatN m00(mat4.m00), m01(mat4.m01), m02(mat4.m02), m03(mat4.m03);
+		const FloatN m10(mat4.m10), m11(mat4.m11), m12(mat4.m12), m13(mat4.m13);
+		const FloatN m20(mat4.m20), m21(mat4.m21), m22(mat4.m22), m23(mat4.m23);
+		const FloatN m30(mat4.m30), m31(mat4.m31), m32(mat4.m32), m33(mat4.m33);
+
+		const uInt8* src	= static_cast<const uInt8*>(in);
+		uInt8* dst			= static_cast<uInt8*>(out);
+
+		for (uSize base = 0; base < count; base += QMATH_SIMD_MAX_WIDTH)
+		{
+			const uSize blockCount = Min<uSize>(count - base, QMATH_SIMD_MAX_WIDTH);
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				const float* vec = reinterpret_cast<const float*>(src + (base + i) * inStride);
+				x[i] = vec[0];
+				y[i] = vec[1];
+				z[i] = vec[2];
+			}
+
+			for (uSize i = blockCount; i < QMATH_SIMD_MAX_WIDTH; i++)
+			{
+				x[i] = y[i] = z[i] = 0.0f;
+			}
+
+			for (uSize i = 0; i < QMATH_SIMD_MAX_WIDTH; i += QMATH_SIMD_WIDTH)
+			{
+				const FloatN vx = FloatN::Load(x + i);
+				const FloatN vy = FloatN::Load(y + i);
+				const FloatN vz = FloatN::Load(z + i);
+
+				if (mode == BatchTransformMode::Direction)
+				{
+					MulAdd(vz, m20, MulAdd(vy, m10, vx * m00)).Store(x + i);
+					MulAdd(vz, m21, MulAdd(vy, m11, vx * m01)).Store(y + i);
+					MulAdd(vz, m22, MulAdd(vy, m12, vx * m02)).Store(z + i);
+				}
+				else if (mode == BatchTransformMode::Point)
+				{
+					MulAdd(vz, m20, MulAdd(vy, m10, MulAdd(vx, m00, m30))).Store(x + i);
+					MulAdd(vz, m21, MulAdd(vy, m11, MulAdd(vx, m01, m31))).Store(y + i);
+					MulAdd(vz, m22, MulAdd(vy, m12, MulAdd(vx, m02, m32))).Store(z + i);
+				}
+				else
+				{
+					const FloatN invW = FloatN(1.0f) / MulAdd(vz, m23, MulAdd(vy, m13, MulAdd(vx, m03, m33)));
+					(MulAdd(vz, m20, MulAdd(vy, m10, MulAdd(vx, m00, m30))) * invW).Store(x + i);
+					(MulAdd(vz, m21, MulAdd(vy, m11, MulAdd(vx, m01, m31))) * invW).Store(y + i);
+					(MulAdd(vz, m22, MulAdd(vy, m12, MulAdd(vx, m02, m32))) * invW).Store(z + i);
+				}
+			}
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				float* vec = reinterpret_cast<float*>(dst + (base + i) * outStride);
+				vec[0] = x[i];
+				vec[1] = y[i];
+				vec[2] = z[i];
+			}
+		}
+	}
+
+	/** Transform count points by mat4 (w = 1), same as Matrix4::operator*(Vector3) */
+	inline void TransformPoints(const Mat4f& mat4, const Vec3f* in, Vec3f* out, uSize count)
+	{
+		BatchTransformVec3<BatchTransformMode::Point>(mat4, in, sizeof(Vec3f), out, sizeof(Vec3f), count);
+	}
+
+	/** Transform count points by mat4 (w = 1) with byte strides */
+	inline void TransformPoints(const Mat4f& mat4,
+		const void* in, uSize inStride, void* out, uSize outStride, uSize count)
+	{
+		BatchTransformVec3<BatchTransformMode::Point>(mat4, in, inStride, out, outStride, count);
+	}
+
+	/** Transform count directions by mat4 (w = 0) */
+	inline void TransformDirections(const Mat4f& mat4, const Vec3f* in, Vec3f* out, uSize count)
+	{
+		BatchTransformVec3<BatchTransformMode::Direction>(mat4, in, sizeof(Vec3f), out, sizeof(Vec3f), count);
+	}
+
+	/** Transform count directions by mat4 (w = 0) with byte strides */
+	inline void TransformDirections(const Mat4f& mat4,
+		const void* in, uSize inStride, void* out, uSize outStride, uSize count)
+	{
+		BatchTransformVec3<BatchTransformMode::Direction>(mat4, in, inStride, out, outStride, count);
+	}
+
+	/** Transform count points by mat4 (w = 1) and divide by the resulting w */
+	inline void TransformPointsProjective(const Mat4f& mat4, const Vec3f* in, Vec3f* out, uSize count)
+	{
+		BatchTransformVec3<BatchTransformMode::Projective>(mat4, in, sizeof(Vec3f), out, sizeof(Vec3f), count);
+	}
+
+	/** Transform count points by mat4 (w = 1) and divide by the resulting w with byte strides */
+	inline void TransformPointsProjective(const Mat4f& mat4,
+		const void* in, uSize inStride, void* out, uSize outStride, uSize count)
+	{
+		BatchTransformVec3<BatchTransformMode::Projective>(mat4, in, inStride, out, outStride, count);
+	}
+
+	/*====================================================
+	|             QUARTZMATH BATCH ROTATIONS             |
+	=====================================================*/
+
+	// Batch rotations convert blocks of QMATH_SIMD_MAX_WIDTH Euler angles,
+	// axis-angle pairs or quaternions into quaternions or rotation matrices.
+	// Inputs are gathered into SoA lanes and the half angle sin/cos of every
+	// lane is computed with FastTrig SinCos, so quaternions differ from
+	// Quaternion::SetEuler / SetAxisAngle (libm) by at most ~2e-7 and
+	// matrices by ~1e-6. With QMATH_USE_FAST_TRIG (and without FMA) they
+	// match the scalar functions exactly. The *ToMat4 functions build the
+	// matrix straight from the quaternion lanes, without writing quaternions.
+	// Matrices match Matrix4::SetRotation. Inputs and outputs may not overlap.
+
+	enum class BatchRotationSource
+	{
+		Euler,		// Vec3f euler angles, same as Quaternion::SetEuler
+		AxisAngle,	// Vec3f axis and float angle, same as Quaternion::SetAxisAngle
+		Quaternion	// Quatf
+	};
+
+	template<BatchRotationSource source, bool toMatrix>
+	inline void BatchRotation(const Vec3f* vecs, const float* angles, const Quatf* quats,
+		Quatf* outQuats, Mat4f* outMats, uSize count)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float in[4][width];
+		alignas(QMATH_SIMD_ALIGNMENT) float out[9][width];
+
+		const FloatN half(0.5f);
+		const FloatN one(1.0f);
+		const FloatN two(2.0f);
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				if (source == BatchRotationSource::Quaternion)
+				{
+					const Quatf& quat = quats[base + i];
+					in[0][i] = quat.x;
+					in[1][i] = quat.y;
+					in[2][i] = quat.z;
+					in[3][i] = quat.w;
+				}
+				else
+				{
+					const Vec3f& vec = vecs[base + i];
+					in[0][i] = vec.x;
+					in[1][i] = vec.y;
+					in[2][i] = vec.z;
+					in[3][i] = source == BatchRotationSource::AxisAngle ? angles[base + i] : 0.0f;
+				}
+			}
+
+			for (uSize i = blockCount; i < width; i++)
+			{
+				in[0][i] = in[1][i] = in[2][i] = in[3][i] = 0.0f;
+			}
+
+			for (uSize i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				FloatN qx, qy, qz, qw;
+
+				if (source == BatchRotationSource::Euler)
+				{
+					FloatN sx, sy, sz, cx, cy, cz;
+					SinCos(FloatN::Load(in[0] + i) * half, sx, cx);
+					SinCos(FloatN::Load(in[1] + i) * half, sy, cy);
+					SinCos(FloatN::Load(in[2] + i) * half, sz, cz);
+
+					qx = cx * sy * sz + cy * cz * sx;
+					qy = cx * cz * sy - cy * sx * sz;
+					qz = cx * cy * sz - cz * sx * sy;
+					qw = sx * sy * sz + cx * cy * cz;
+				}
+				else if (source == BatchRotationSource::AxisAngle)
+				{
+					FloatN sinHalfAngle, cosHalfAngle;
+					SinCos(FloatN::Load(in[3] + i) * half, sinHalfAngle, cosHalfAngle);
+
+					qx = FloatN::Load(in[0] + i) * sinHalfAngle;
+					qy = FloatN::Load(in[1] + i) * sinHalfAngle;
+					qz = FloatN::Load(in[2] + i) * sinHalfAngle;
+					qw = cosHalfAngle;
+				}
+				else
+				{
+					qx = FloatN::Load(in[0] + i);
+					qy = FloatN::Load(in[1] + i);
+					qz = FloatN::Load(in[2] + i);
+					qw = FloatN::Load(in[3] + i);
+				}
+
+				if (!toMatrix)
+				{
+					qx.Store(out[0] + i);
+					qy.Store(out[1] + i);
+					qz.Store(out[2] + i);
+					qw.Store(out[3] + i);
+				}
+				else
+				{
+					(one - two * (qy * qy + qz * qz)).Store(out[0] + i);
+					(two * (qx * qy + qz * qw)).Store(out[1] + i);
+					(two * (qx * qz - qy * qw)).Store(out[2] + i);
+
+					(two * (qx * qy - qz * qw)).Store(out[3] + i);
+					(one - two * (qx * qx + qz * qz)).Store(out[4] + i);
+					(two * (qy * qz + qx * qw)).Store(out[5] + i);
+
+					(two * (qx * qz + qy * qw)).Store(out[6] + i);
+					(two * (qy * qz - qx * qw)).Store(out[7] + i);
+					(one - two * (qx * qx + qy * qy)).Store(out[8] + i);
+				}
+			}
+
+			uSize i = 0;
+
+		#if QMATH_SSE2
+			// Transpose four lanes of each matrix row so every row is a single store
+			if (toMatrix)
+			{
+				const __m128 zero	= _mm_setzero_ps();
+				const __m128 row3	= _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+				for (; i + 4 <= blockCount; i += 4)
+				{
+					for (uSize row = 0; row < 3; row++)
+					{
+						__m128 col0 = Simd::Load4(out[row * 3 + 0] + i);
+						__m128 col1 = Simd::Load4(out[row * 3 + 1] + i);
+						__m128 col2 = Simd::Load4(out[row * 3 + 2] + i);
+						__m128 col3 = zero;
+
+						_MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+
+						Simd::Store4(outMats[base + i + 0].e + row * 4, col0);
+						Simd::Store4(outMats[base + i + 1].e + row * 4, col1);
+						Simd::Store4(outMats[base + i + 2].e + row * 4, col2);
+						Simd::Store4(outMats[base + i + 3].e + row * 4, col3);
+					}
+
+					for (uSize lane = 0; lane < 4; lane++)
+					{
+						Simd::Store4(outMats[base + i + lane].e + 12, row3);
+					}
+				}
+			}
+		#endif
+
+			for (; i < blockCount; i++)
+			{
+				if (!toMatrix)
+				{
+					outQuats[base + i] = Quatf(out[0][i], out[1][i], out[2][i], out[3][i]);
+				}
+				else
+				{
+					Mat4f& mat = outMats[base + i];
+					mat.m00 = out[0][i]; mat.m01 = out[1][i]; mat.m02 = out[2][i]; mat.m03 = 0.0f;
+					mat.m10 = out[3][i]; mat.m11 = out[4][i]; mat.m12 = out[5][i]; mat.m13 = 0.0f;
+					mat.m20 = out[6][i]; mat.m21 = out[7][i]; mat.m22 = out[8][i]; mat.m23 = 0.0f;
+					mat.m30 = 0.0f;		 mat.m31 = 0.0f;	  mat.m32 = 0.0f;	   mat.m33 = 1.0f;
+				}
+			}
+		}
+	}
+
+	/** Convert count euler angles to quaternions, same as Quaternion::SetEuler */
+	inline void EulerToQuat(const Vec3f* euler, Quatf* out, uSize count)
+	{
+		BatchRotation<BatchRotationSource::Euler, false>(euler, nullptr, nullptr, out, nullptr, count);
+	}
+
+	/** Convert count axis-angle pairs to quaternions, same as Quaternion::SetAxisAngle */
+	inline void AxisAngleToQuat(const Vec3f* axes, const float* angles, Quatf* out, uSize count)
+	{
+		BatchRotation<BatchRotationSource::AxisAngle, false>(axes, angles, nullptr, out, nullptr, count);
+	}
+
+	/** Convert count quaternions to rotation matrices, same as Matrix4::SetRotation */
+	inline void QuatToMat4(const Quatf* quats, Mat4f* out, uSize count)
+	{
+		BatchRotation<BatchRotationSource::Quaternion, true>(nullptr, nullptr, quats, nullptr, out, count);
+	}
+
+	/** Convert count euler angles to rotation matrices without storing the quaternions */
+	inline void EulerToMat4(const Vec3f* euler, Mat4f* out, uSize count)
+	{
+		BatchRotation<BatchRotationSource::Euler, true>(euler, nullptr, nullptr, nullptr, out, count);
+	}
+
+	/** Convert count axis-angle pairs to rotation matrices without storing the quaternions */
+	inline void AxisAngleToMat4(const Vec3f* axes, const float* angles, Mat4f* out, uSize count)
+	{
+		BatchRotation<BatchRotationSource::AxisAngle, true>(axes, angles, nullptr, nullptr, out, count);
+	}
+
+	/*====================================================
+	|                 QUARTZMATH BATCH TRS               |
+	=====================================================*/
+
+	// Batch TRS composition builds count Mat4f or Affine3f matrices from
+	// Transforms, QMATH_SIMD_MAX_WIDTH per block: the same products as
+	// Matrix4::SetTRS and Matrix4x3::SetTRS (equal up to FMA contraction).
+	// With indices, transform indices[i] is read and out[indices[i]] written,
+	// so only the selected entries of a larger array are touched.
+	//
+	// Decomposition is the inverse, Matrix4::DecomposeTRS per lane: row
+	// lengths for scale, RotationToQuatKernel on the normalized rows. It
+	// round trips ComposeTRS to ~1e-6 for scales that are not tiny.
+
+	/** Element index of row and column in MatrixType (Mat4f or Affine3f) */
+	template<typename MatrixType>
+	constexpr uSize TRSElement(uSize row, uSize column)
+	{
+		return row * (std::is_same_v<MatrixType, Mat4f> ? 4 : 3) + column;
+	}
+
+	template<typename MatrixType, bool indexed>
+	inline void BatchComposeTRS(const Transform* transforms, const uInt32* indices, MatrixType* out, uSize count)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float in[10][width];
+		alignas(QMATH_SIMD_ALIGNMENT) float a[12][width];
+
+		const FloatN one(1.0f);
+		const FloatN two(2.0f);
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			uSize i = 0;
+
+		#if QMATH_SSE2
+			static_assert(sizeof(Transform) == 10 * sizeof(float), "Transform must be ten packed floats");
+
+			// Transform is ten floats: two groups of four and a pair, each transposed into lanes
+			for (; i + 4 <= blockCount; i += 4)
+			{
+				const Transform* source[4];
+
+				for (uSize lane = 0; lane < 4; lane++)
+				{
+					source[lane] = &transforms[indexed ? indices[base + i + lane] : base + i + lane];
+				}
+
+				for (uSize group = 0; group < 8; group += 4)
+				{
+					__m128 e0 = Simd::Load4(&source[0]->position.x + group);
+					__m128 e1 = Simd::Load4(&source[1]->position.x + group);
+					__m128 e2 = Simd::Load4(&source[2]->position.x + group);
+					__m128 e3 = Simd::Load4(&source[3]->position.x + group);
+
+					_MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+
+					Simd::Store4(in[group + 0] + i, e0);
+					Simd::Store4(in[group + 1] + i, e1);
+					Simd::Store4(in[group + 2] + i, e2);
+					Simd::Store4(in[group + 3] + i, e3);
+				}
+
+				const __m128 pair01 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(),
+					(const __m64*)&source[0]->scale.y), (const __m64*)&source[1]->scale.y);
+				const __m128 pair23 = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(),
+					(const __m64*)&source[2]->scale.y), (const __m64*)&source[3]->scale.y);
+
+				Simd::Store4(in[8] + i, _mm_shuffle_ps(pair01, pair23, _MM_SHUFFLE(2, 0, 2, 0)));
+				Simd::Store4(in[9] + i, _mm_shuffle_ps(pair01, pair23, _MM_SHUFFLE(3, 1, 3, 1)));
+			}
+		#endif
+
+			for (; i < blockCount; i++)
+			{
+				const Transform& transform = transforms[indexed ? indices[base + i] : base + i];
+				in[0][i] = transform.position.x;
+				in[1][i] = transform.position.y;
+				in[2][i] = transform.position.z;
+				in[3][i] = transform.rotation.x;
+				in[4][i] = transform.rotation.y;
+				in[5][i] = transform.rotation.z;
+				in[6][i] = transform.rotation.w;
+				in[7][i] = transform.scale.x;
+				in[8][i] = transform.scale.y;
+				in[9][i] = transform.scale.z;
+			}
+
+			for (; i < width; i++)
+			{
+				for (uSize lane = 0; lane < 10; lane++)
+				{
+					in[lane][i] = 0.0f;
+				}
+			}
+
+			for (i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				const FloatN qx = FloatN::Load(in[3] + i);
+				const FloatN qy = FloatN::Load(in[4] + i);
+				const FloatN qz = FloatN::Load(in[5] + i);
+				const FloatN qw = FloatN::Load(in[6] + i);
+
+				const FloatN sx = FloatN::Load(in[7] + i);
+				const FloatN sy = FloatN::Load(in[8] + i);
+				const FloatN sz = FloatN::Load(in[9] + i);
+
+				((one - two * (qy * qy + qz * qz)) * sx).Store(a[0] + i);
+				((two * (qx * qy + qz * qw)) * sx).Store(a[1] + i);
+				((two * (qx * qz - qy * qw)) * sx).Store(a[2] + i);
+
+				((two * (qx * qy - qz * qw)) * sy).Store(a[3] + i);
+				((one - two * (qx * qx + qz * qz)) * sy).Store(a[4] + i);
+				((two * (qy * qz + qx * qw)) * sy).Store(a[5] + i);
+
+				((two * (qx * qz + qy * qw)) * sz).Store(a[6] + i);
+				((two * (qy * qz - qx * qw)) * sz).Store(a[7] + i);
+				((one - two * (qx * qx + qy * qy)) * sz).Store(a[8] + i);
+
+				FloatN::Load(in[0] + i).Store(a[9] + i);
+				FloatN::Load(in[1] + i).Store(a[10] + i);
+				FloatN::Load(in[2] + i).Store(a[11] + i);
+			}
+
+			i = 0;
+
+		#if QMATH_SSE2
+			for (; i + 4 <= blockCount; i += 4)
+			{
+				MatrixType* mats[4];
+
+				for (uSize lane = 0; lane < 4; lane++)
+				{
+					mats[lane] = &out[indexed ? indices[base + i + lane] : base + i + lane];
+				}
+
+				if constexpr (std::is_same_v<MatrixType, Mat4f>)
+				{
+					// Each row is a 4x4 transpose of three element lanes and the constant last column
+					for (uSize row = 0; row < 4; row++)
+					{
+						__m128 e0 = Simd::Load4(a[row * 3 + 0] + i);
+						__m128 e1 = Simd::Load4(a[row * 3 + 1] + i);
+						__m128 e2 = Simd::Load4(a[row * 3 + 2] + i);
+						__m128 e3 = row == 3 ? _mm_set1_ps(1.0f) : _mm_setzero_ps();
+
+						_MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+
+						Simd::Store4(mats[0]->e + row * 4, e0);
+						Simd::Store4(mats[1]->e + row * 4, e1);
+						Simd::Store4(mats[2]->e + row * 4, e2);
+						Simd::Store4(mats[3]->e + row * 4, e3);
+					}
+				}
+				else
+				{
+					// Four matrices are three 4x4 transposes of the element lanes
+					for (uSize group = 0; group < 12; group += 4)
+					{
+						__m128 e0 = Simd::Load4(a[group + 0] + i);
+						__m128 e1 = Simd::Load4(a[group + 1] + i);
+						__m128 e2 = Simd::Load4(a[group + 2] + i);
+						__m128 e3 = Simd::Load4(a[group + 3] + i);
+
+						_MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+
+						Simd::Store4(mats[0]->e + group, e0);
+						Simd::Store4(mats[1]->e + group, e1);
+						Simd::Store4(mats[2]->e + group, e2);
+						Simd::Store4(mats[3]->e + group, e3);
+					}
+				}
+			}
+		#endif
+
+			for (; i < blockCount; i++)
+			{
+				MatrixType& mat = out[indexed ? indices[base + i] : base + i];
+
+				for (uSize element = 0; element < 12; element++)
+				{
+					mat.e[TRSElement<MatrixType>(element / 3, element % 3)] = a[element][i];
+				}
+
+				if constexpr (std::is_same_v<MatrixType, Mat4f>)
+				{
+					mat.m03 = 0.0f;
+					mat.m13 = 0.0f;
+					mat.m23 = 0.0f;
+					mat.m33 = 1.0f;
+				}
+			}
+		}
+	}
+
+	template<typename MatrixType>
+	inline void BatchDecomposeTRS(const MatrixType* mats, Transform* out, uSize count)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float in[12][width];
+		alignas(QMATH_SIMD_ALIGNMENT) float a[10][width];
+
+		const FloatN zero(0.0f);
+		const FloatN one(1.0f);
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			uSize i = 0;
+
+		#if QMATH_SSE2
+			if constexpr (std::is_same_v<MatrixType, Mat4f>)
+			{
+				// Transpose each row of four matrices, the last column lands in a discarded lane
+				for (; i + 4 <= blockCount; i += 4)
+				{
+					for (uSize row = 0; row < 4; row++)
+					{
+						__m128 e0 = Simd::Load4(mats[base + i + 0].e + row * 4);
+						__m128 e1 = Simd::Load4(mats[base + i + 1].e + row * 4);
+						__m128 e2 = Simd::Load4(mats[base + i + 2].e + row * 4);
+						__m128 e3 = Simd::Load4(mats[base + i + 3].e + row * 4);
+
+						_MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+
+						Simd::Store4(in[row * 3 + 0] + i, e0);
+						Simd::Store4(in[row * 3 + 1] + i, e1);
+						Simd::Store4(in[row * 3 + 2] + i, e2);
+					}
+				}
+			}
+			else
+			{
+				for (; i + 4 <= blockCount; i += 4)
+				{
+					for (uSize group = 0; group < 12; group += 4)
+					{
+						__m128 e0 = Simd::Load4(mats[base + i + 0].e + group);
+						__m128 e1 = Simd::Load4(mats[base + i + 1].e + group);
+						__m128 e2 = Simd::Load4(mats[base + i + 2].e + group);
+						__m128 e3 = Simd::Load4(mats[base + i + 3].e + group);
+
+						_MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+
+						Simd::Store4(in[group + 0] + i, e0);
+						Simd::Store4(in[group + 1] + i, e1);
+						Simd::Store4(in[group + 2] + i, e2);
+						Simd::Store4(in[group + 3] + i, e3);
+					}
+				}
+			}
+		#endif
+
+			for (; i < blockCount; i++)
+			{
+				for (uSize element = 0; element < 12; element++)
+				{
+					in[element][i] = mats[base + i].e[TRSElement<MatrixType>(element / 3, element % 3)];
+				}
+			}
+
+			// Identity padding keeps the unused lanes finite
+			for (; i < width; i++)
+			{
+				for (uSize element = 0; element < 12; element++)
+				{
+					in[element][i] = element == 0 || element == 4 || element == 8 ? 1.0f : 0.0f;
+				}
+			}
+
+			for (i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				FloatN m00 = FloatN::Load(in[0] + i), m01 = FloatN::Load(in[1] + i), m02 = FloatN::Load(in[2] + i);
+				FloatN m10 = FloatN::Load(in[3] + i), m11 = FloatN::Load(in[4] + i), m12 = FloatN::Load(in[5] + i);
+				FloatN m20 = FloatN::Load(in[6] + i), m21 = FloatN::Load(in[7] + i), m22 = FloatN::Load(in[8] + i);
+
+				const FloatN determinant =
+					  m00 * (m11 * m22 - m12 * m21)
+					- m01 * (m10 * m22 - m12 * m20)
+					+ m02 * (m10 * m21 - m11 * m20);
+
+				FloatN sx = Sqrt(m00 * m00 + m01 * m01 + m02 * m02);
+				FloatN sy = Sqrt(m10 * m10 + m11 * m11 + m12 * m12);
+				FloatN sz = Sqrt(m20 * m20 + m21 * m21 + m22 * m22);
+
+				sx = Select(LessThan(determinant, zero), zero - sx, sx);
+
+				const FloatN ix = one / sx;
+				const FloatN iy = one / sy;
+				const FloatN iz = one / sz;
+
+				FloatN qx, qy, qz, qw;
+				RotationToQuatKernel(
+					m00 * ix, m01 * ix, m02 * ix,
+					m10 * iy, m11 * iy, m12 * iy,
+					m20 * iz, m21 * iz, m22 * iz,
+					qx, qy, qz, qw);
+
+				FloatN::Load(in[9] + i).Store(a[0] + i);
+				FloatN::Load(in[10] + i).Store(a[1] + i);
+				FloatN::Load(in[11] + i).Store(a[2] + i);
+				qx.Store(a[3] + i);
+				qy.Store(a[4] + i);
+				qz.Store(a[5] + i);
+				qw.Store(a[6] + i);
+				sx.Store(a[7] + i);
+				sy.Store(a[8] + i);
+				sz.Store(a[9] + i);
+			}
+
+			for (i = 0; i < blockCount; i++)
+			{
+				Transform& transform = out[base + i];
+				transform.position	= Vec3f(a[0][i], a[1][i], a[2][i]);
+				transform.rotation	= Quatf(a[3][i], a[4][i], a[5][i], a[6][i]);
+				transform.scale		= Vec3f(a[7][i], a[8][i], a[9][i]);
+			}
+		}
+	}
+
+	/** Compose count transforms into matrices, same as Matrix4::SetTRS */
+	inline void ComposeTRS(const Transform* transforms, Mat4f* out, uSize count)
+	{
+		BatchComposeTRS<Mat4f, false>(transforms, nullptr, out, count);
+	}
+
+	/** Compose count transforms into affine matrices, same as Matrix4x3::SetTRS */
+	inline void ComposeAffine(const Transform* transforms, Affine3f* out, uSize count)
+	{
+		BatchComposeTRS<Affine3f, false>(transforms, nullptr, out, count);
+	}
+
+	/** Compose transforms[indices[i]] into out[indices[i]] for count indices */
+	inline void ComposeAffine(const Transform* transforms, const uInt32* indices, Affine3f* out, uSize count)
+	{
+		BatchComposeTRS<Affine3f, true>(transforms, indices, out, count);
+	}
+
+	/** Split count affine matrices into transforms, same as Matrix4::DecomposeTRS */
+	inline void DecomposeTRS(const Mat4f* mats, Transform* out, uSize count)
+	{
+		BatchDecomposeTRS(mats, out, count);
+	}
+
+	/** Split count affine matrices into transforms, same as Matrix4x3::DecomposeTRS */
+	inline void DecomposeTRS(const Affine3f* mats, Transform* out, uSize count)
+	{
+		BatchDecomposeTRS(mats, out, count);
+	}
+
+	/*====================================================
+	|              QUARTZMATH BATCH BLENDING             |
+	=====================================================*/
+
+	// Batch blending interpolates count bone rotations from one pose to
+	// another with a weight per bone, QMATH_SIMD_MAX_WIDTH bones per block.
+	// Both poses are gathered into SoA lanes, so out may be the same buffer
+	// as from or to. Accuracy is that of the scalar functions (see
+	// QUARTZMATH QUATERNION INTERPOLATION): Slerp uses the SlerpFastWeights
+	// polynomial, Nlerp normalizes with FastInvsereSquare.
+
+	template<bool spherical>
+	inline void BatchBlend(const Quatf* from, const Quatf* to, const float* weights, Quatf* out, uSize count)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float a[4][width];
+		alignas(QMATH_SIMD_ALIGNMENT) float b[4][width];
+		alignas(QMATH_SIMD_ALIGNMENT) float t[width];
+
+		const FloatN zero(0.0f);
+		const FloatN one(1.0f);
+		const FloatN minusOne(-1.0f);
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			uSize i = 0;
+
+		#if QMATH_SSE2
+			// Transpose four quaternions at a time into x, y, z, w lanes
+			for (; i + 4 <= blockCount; i += 4)
+			{
+				__m128 a0 = Simd::Load4(from[base + i + 0].e), a1 = Simd::Load4(from[base + i + 1].e);
+				__m128 a2 = Simd::Load4(from[base + i + 2].e), a3 = Simd::Load4(from[base + i + 3].e);
+				__m128 b0 = Simd::Load4(to[base + i + 0].e), b1 = Simd::Load4(to[base + i + 1].e);
+				__m128 b2 = Simd::Load4(to[base + i + 2].e), b3 = Simd::Load4(to[base + i + 3].e);
+
+				_MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+				_MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+
+				Simd::Store4(a[0] + i, a0); Simd::Store4(a[1] + i, a1);
+				Simd::Store4(a[2] + i, a2); Simd::Store4(a[3] + i, a3);
+				Simd::Store4(b[0] + i, b0); Simd::Store4(b[1] + i, b1);
+				Simd::Store4(b[2] + i, b2); Simd::Store4(b[3] + i, b3);
+				Simd::Store4(t + i, Simd::Load4(weights + base + i));
+			}
+		#endif
+
+			for (; i < blockCount; i++)
+			{
+				const Quatf& quat1 = from[base + i];
+				const Quatf& quat2 = to[base + i];
+				a[0][i] = quat1.x; a[1][i] = quat1.y; a[2][i] = quat1.z; a[3][i] = quat1.w;
+				b[0][i] = quat2.x; b[1][i] = quat2.y; b[2][i] = quat2.z; b[3][i] = quat2.w;
+				t[i] = weights[base + i];
+			}
+
+			// Identity padding keeps the unused lanes finite
+			for (i = blockCount; i < width; i++)
+			{
+				a[0][i] = a[1][i] = a[2][i] = b[0][i] = b[1][i] = b[2][i] = t[i] = 0.0f;
+				a[3][i] = b[3][i] = 1.0f;
+			}
+
+			for (i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				const FloatN ax = FloatN::Load(a[0] + i), ay = FloatN::Load(a[1] + i);
+				const FloatN az = FloatN::Load(a[2] + i), aw = FloatN::Load(a[3] + i);
+				const FloatN bx = FloatN::Load(b[0] + i), by = FloatN::Load(b[1] + i);
+				const FloatN bz = FloatN::Load(b[2] + i), bw = FloatN::Load(b[3] + i);
+				const FloatN vt = FloatN::Load(t + i);
+
+				const FloatN cosTheta	= MulAdd(aw, bw, MulAdd(az, bz, MulAdd(ay, by, ax * bx)));
+				const FloatN sign		= Select(LessThan(cosTheta, zero), minusOne, one);
+
+				FloatN weight1, weight2;
+
+				if (spherical)
+				{
+					SlerpFastWeights(cosTheta * sign, vt, weight1, weight2);
+				}
+				else
+				{
+					weight1 = one - vt;
+					weight2 = vt;
+				}
+
+				weight2 = weight2 * sign;
+
+				FloatN qx = MulAdd(bx, weight2, ax * weight1);
+				FloatN qy = MulAdd(by, weight2, ay * weight1);
+				FloatN qz = MulAdd(bz, weight2, az * weight1);
+				FloatN qw = MulAdd(bw, weight2, aw * weight1);
+
+				if (!spherical)
+				{
+					const FloatN inverse = FastInvsereSquare(MulAdd(qw, qw, MulAdd(qz, qz, MulAdd(qy, qy, qx * qx))));
+					qx = qx * inverse;
+					qy = qy * inverse;
+					qz = qz * inverse;
+					qw = qw * inverse;
+				}
+
+				qx.Store(a[0] + i);
+				qy.Store(a[1] + i);
+				qz.Store(a[2] + i);
+				qw.Store(a[3] + i);
+			}
+
+			i = 0;
+
+		#if QMATH_SSE2
+			for (; i + 4 <= blockCount; i += 4)
+			{
+				__m128 q0 = Simd::Load4(a[0] + i), q1 = Simd::Load4(a[1] + i);
+				__m128 q2 = Simd::Load4(a[2] + i), q3 = Simd::Load4(a[3] + i);
+
+				_MM_TRANSPOSE4_PS(q0, q1, q2, q3);
+
+				Simd::Store4(out[base + i + 0].e, q0);
+				Simd::Store4(out[base + i + 1].e, q1);
+				Simd::Store4(out[base + i + 2].e, q2);
+				Simd::Store4(out[base + i + 3].e, q3);
+			}
+		#endif
+
+			for (; i < blockCount; i++)
+			{
+				out[base + i] = Quatf(a[0][i], a[1][i], a[2][i], a[3][i]);
+			}
+		}
+	}
+
+	/** Nlerp count rotations from one pose to another, weights[i] is the weight of to[i] */
+	inline void Nlerp(const Quatf* from, const Quatf* to, const float* weights, Quatf* out, uSize count)
+	{
+		BatchBlend<false>(from, to, weights, out, count);
+	}
+
+	/** Slerp count rotations from one pose to another, weights[i] is the weight of to[i] */
+	inline void Slerp(const Quatf* from, const Quatf* to, const float* weights, Quatf* out, uSize count)
+	{
+		BatchBlend<true>(from, to, weights, out, count);
+	}
+
+	/*====================================================
+	|              QUARTZMATH BATCH SKINNING             |
+	=====================================================*/
+
+	// Skinning deforms Vec3fSoA vertex streams by SKIN_INFLUENCES bones per
+	// vertex. Influences are interleaved per vertex, boneIndices[v * 4 + k]
+	// and boneWeights[v * 4 + k], with weights summing to one. Unused slots
+	// have a weight of zero and any valid bone index.
+	//
+	// SkinDualQuaternion blends unit DualQuatf bones, each flipped to the
+	// hemisphere of the vertex's first influence, then normalizes, so the
+	// blend stays rigid instead of collapsing at twisted joints. SkinLinear
+	// blends Affine3f bones (linear blend skinning), which also handles
+	// scale. Both blend each vertex's bones as groups of four floats and
+	// transpose the results into SoA lanes for the transform. A dual
+	// quaternion is 8 floats against 12, and normalization folds into one
+	// scale of the transformed offset, so it is the cheaper of the two.
+	//
+	// Normals are rotated by the blended rotation (DQ) or multiplied by the
+	// blended linear part (linear), they are not renormalized. With normals,
+	// Min(positions.size, normals.size) vertices are skinned and both outputs
+	// are resized to that count.
+
+	constexpr uSize SKIN_INFLUENCES = 4;
+
+	/** Contiguous floats of a skinning bone */
+	inline const float* SkinBoneFloats(const DualQuatf& bone)
+	{
+		static_assert(sizeof(DualQuatf) == 8 * sizeof(float), "DualQuatf must be eight packed floats");
+		return bone.real.e;
+	}
+
+	/** Contiguous floats of a skinning bone */
+	inline const float* SkinBoneFloats(const Affine3f& bone)
+	{
+		return bone.e;
+	}
+
+	template<typename BoneType>
+	inline void BatchSkin(const BoneType* bones, const uInt32* boneIndices, const float* boneWeights,
+		const Vec3fSoA& positions, const Vec3fSoA* normals, Vec3fSoA& outPositions, Vec3fSoA* outNormals)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+		constexpr uSize lanes = sizeof(BoneType) / sizeof(float);
+		constexpr bool dualQuat = std::is_same_v<BoneType, DualQuatf>;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float blended[lanes][width];
+
+		const FloatN zero(0.0f);
+		const FloatN two(2.0f);
+
+		// A shorter normal stream limits the vertex count so it is never read past its end
+		const uSize count = normals ? Min(positions.size, normals->size) : positions.size;
+
+		outPositions.Resize(count);
+
+		if (normals)
+		{
+			outNormals->Resize(count);
+		}
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			uSize i = 0;
+
+		#if QMATH_SSE2
+			// Blend each vertex's bones as groups of four floats, then transpose four vertices into lanes
+			for (; i + 4 <= blockCount; i += 4)
+			{
+				__m128 vertex[4][lanes / 4];
+
+				for (uSize v = 0; v < 4; v++)
+				{
+					const uInt32* index = boneIndices + (base + i + v) * SKIN_INFLUENCES;
+
+					const float* source[SKIN_INFLUENCES];
+
+					for (uSize k = 0; k < SKIN_INFLUENCES; k++)
+					{
+						source[k] = SkinBoneFloats(bones[index[k]]);
+					}
+
+					__m128 weights = Simd::Load4(boneWeights + (base + i + v) * SKIN_INFLUENCES);
+
+					if constexpr (dualQuat)
+					{
+						// Flip each rotation to the hemisphere of the first, all four dot products in
+						// one transpose. The first with itself is positive, so its weight is kept
+						const __m128 first = Simd::Load4(source[0]);
+
+						__m128 d0 = _mm_mul_ps(first, first), d1 = _mm_mul_ps(Simd::Load4(source[1]), first);
+						__m128 d2 = _mm_mul_ps(Simd::Load4(source[2]), first), d3 = _mm_mul_ps(Simd::Load4(source[3]), first);
+
+						_MM_TRANSPOSE4_PS(d0, d1, d2, d3);
+
+						const __m128 cosTheta = _mm_add_ps(_mm_add_ps(d0, d1), _mm_add_ps(d2, d3));
+						weights = _mm_xor_ps(weights, _mm_and_ps(cosTheta, _mm_set1_ps(-0.0f)));
+					}
+
+					const __m128 weight[SKIN_INFLUENCES] =
+					{
+						Simd::Splat4<0>(weights), Simd::Splat4<1>(weights),
+						Simd::Splat4<2>(weights), Simd::Splat4<3>(weights)
+					};
+
+					for (uSize group = 0; group < lanes / 4; group++)
+					{
+						__m128 sum = _mm_mul_ps(Simd::Load4(source[0] + group * 4), weight[0]);
+
+						for (uSize k = 1; k < SKIN_INFLUENCES; k++)
+						{
+							sum = _mm_add_ps(sum, _mm_mul_ps(Simd::Load4(source[k] + group * 4), weight[k]));
+						}
+
+						vertex[v][group] = sum;
+					}
+				}
+
+				for (uSize group = 0; group < lanes / 4; group++)
+				{
+					__m128 e0 = vertex[0][group], e1 = vertex[1][group];
+					__m128 e2 = vertex[2][group], e3 = vertex[3][group];
+
+					_MM_TRANSPOSE4_PS(e0, e1, e2, e3);
+
+					Simd::Store4(blended[group * 4 + 0] + i, e0);
+					Simd::Store4(blended[group * 4 + 1] + i, e1);
+					Simd::Store4(blended[group * 4 + 2] + i, e2);
+					Simd::Store4(blended[group * 4 + 3] + i, e3);
+				}
+			}
+		#endif
+
+			for (; i < blockCount; i++)
+			{
+				const uInt32* index = boneIndices + (base + i) * SKIN_INFLUENCES;
+				const float* weights = boneWeights + (base + i) * SKIN_INFLUENCES;
+
+				const float* first = SkinBoneFloats(bones[index[0]]);
+
+				for (uSize lane = 0; lane < lanes; lane++)
+				{
+					blended[lane][i] = first[lane] * weights[0];
+				}
+
+				for (uSize k = 1; k < SKIN_INFLUENCES; k++)
+				{
+					const float* source = SkinBoneFloats(bones[index[k]]);
+					float weightK = weights[k];
+
+					if constexpr (dualQuat)
+					{
+						const float cosTheta = source[0] * first[0] + source[1] * first[1] + source[2] * first[2] + source[3] * first[3];
+						weightK = cosTheta < 0.0f ? -weightK : weightK;
+					}
+
+					for (uSize lane = 0; lane < lanes; lane++)
+					{
+						blended[lane][i] += source[lane] * weightK;
+					}
+				}
+			}
+
+			// A nonzero real part keeps the unused dual quaternion lanes finite
+			for (i = blockCount; i < width; i++)
+			{
+				for (uSize lane = 0; lane < lanes; lane++)
+				{
+					blended[lane][i] = 0.0f;
+				}
+
+				blended[3][i] = 1.0f;
+			}
+
+			for (i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				FloatN blend[lanes];
+
+				for (uSize lane = 0; lane < lanes; lane++)
+				{
+					blend[lane] = FloatN::Load(blended[lane] + i);
+				}
+
+				const uSize offset = base + i;
+
+				const FloatN x = FloatN::Load(positions.x + offset);
+				const FloatN y = FloatN::Load(positions.y + offset);
+				const FloatN z = FloatN::Load(positions.z + offset);
+
+				if constexpr (dualQuat)
+				{
+					const FloatN rx = blend[0], ry = blend[1], rz = blend[2], rw = blend[3];
+					const FloatN dx = blend[4], dy = blend[5], dz = blend[6], dw = blend[7];
+
+					// Every term below is quadratic in real and dual, so normalizing
+					// is one scale by 2 / |real|^2 instead of dividing all eight
+					const FloatN scale = two / MulAdd(rw, rw, MulAdd(rz, rz, MulAdd(ry, ry, rx * rx)));
+
+					// Rotation and translation in one: p + 2 * (real x c + rw * dual - dw * real),
+					// c = real x p + rw * p + dual
+					FloatN cx = MulAdd(rw, x, MulAdd(ry, z, dx - rz * y));
+					FloatN cy = MulAdd(rw, y, MulAdd(rz, x, dy - rx * z));
+					FloatN cz = MulAdd(rw, z, MulAdd(rx, y, dz - ry * x));
+
+					MulAdd(scale, MulAdd(ry, cz, MulAdd(rw, dx, zero - MulAdd(rz, cy, dw * rx))), x).Store(outPositions.x + offset);
+					MulAdd(scale, MulAdd(rz, cx, MulAdd(rw, dy, zero - MulAdd(rx, cz, dw * ry))), y).Store(outPositions.y + offset);
+					MulAdd(scale, MulAdd(rx, cy, MulAdd(rw, dz, zero - MulAdd(ry, cx, dw * rz))), z).Store(outPositions.z + offset);
+
+					if (normals)
+					{
+						const FloatN nx = FloatN::Load(normals->x + offset);
+						const FloatN ny = FloatN::Load(normals->y + offset);
+						const FloatN nz = FloatN::Load(normals->z + offset);
+
+						cx = MulAdd(rw, nx, ry * nz - rz * ny);
+						cy = MulAdd(rw, ny, rz * nx - rx * nz);
+						cz = MulAdd(rw, nz, rx * ny - ry * nx);
+
+						MulAdd(scale, ry * cz - rz * cy, nx).Store(outNormals->x + offset);
+						MulAdd(scale, rz * cx - rx * cz, ny).Store(outNormals->y + offset);
+						MulAdd(scale, rx * cy - ry * cx, nz).Store(outNormals->z + offset);
+					}
+				}
+				else
+				{
+					MulAdd(z, blend[6], MulAdd(y, blend[3], MulAdd(x, blend[0], blend[9]))).Store(outPositions.x + offset);
+					MulAdd(z, blend[7], MulAdd(y, blend[4], MulAdd(x, blend[1], blend[10]))).Store(outPositions.y + offset);
+					MulAdd(z, blend[8], MulAdd(y, blend[5], MulAdd(x, blend[2], blend[11]))).Store(outPositions.z + offset);
+
+					if (normals)
+					{
+						const FloatN nx = FloatN::Load(normals->x + offset);
+						const FloatN ny = FloatN::Load(normals->y + offset);
+						const FloatN nz = FloatN::Load(normals->z + offset);
+
+						MulAdd(nz, blend[6], MulAdd(ny, blend[3], nx * blend[0])).Store(outNormals->x + offset);
+						MulAdd(nz, blend[7], MulAdd(ny, blend[4], nx * blend[1])).Store(outNormals->y + offset);
+						MulAdd(nz, blend[8], MulAdd(ny, blend[5], nx * blend[2])).Store(outNormals->z + offset);
+					}
+				}
+			}
+		}
+	}
+
+	/** Skin positions by dual quaternion bones, SKIN_INFLUENCES indices and weights per vertex */
+	inline void SkinDualQuaternion(const DualQuatf* bones, const uInt32* boneIndices, const float* boneWeights,
+		const Vec3fSoA& positions, Vec3fSoA& outPositions)
+	{
+		BatchSkin(bones, boneIndices, boneWeights, positions, nullptr, outPositions, nullptr);
+	}
+
+	/** Skin positions and normals by dual quaternion bones, SKIN_INFLUENCES indices and weights per vertex */
+	inline void SkinDualQuaternion(const DualQuatf* bones, const uInt32* boneIndices, const float* boneWeights,
+		const Vec3fSoA& positions, const Vec3fSoA& normals, Vec3fSoA& outPositions, Vec3fSoA& outNormals)
+	{
+		BatchSkin(bones, boneIndices, boneWeights, positions, &normals, outPositions, &outNormals);
+	}
+
+	/** Skin positions by affine bone matrices, SKIN_INFLUENCES indices and weights per vertex */
+	inline void SkinLinear(const Affine3f* bones, const uInt32* boneIndices, const float* boneWeights,
+		const Vec3fSoA& positions, Vec3fSoA& outPositions)
+	{
+		BatchSkin(bones, boneIndices, boneWeights, positions, nullptr, outPositions, nullptr);
+	}
+
+	/** Skin positions and normals by affine bone matrices, SKIN_INFLUENCES indices and weights per vertex */
+	inline void SkinLinear(const Affine3f* bones, const uInt32* boneIndices, const float* boneWeights,
+		const Vec3fSoA& positions, const Vec3fSoA& normals, Vec3fSoA& outPositions, Vec3fSoA& outNormals)
+	{
+		BatchSkin(bones, boneIndices, boneWeights, positions, &normals, outPositions, &outNormals);
+	}
+}
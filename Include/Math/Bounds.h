@@ -41,6 +41,21 @@ namespace Quartz
 			return result;
 		}
 
+		constexpr Bounds2& Extend(const Bounds2& bounds2)
+		{
+			start = Min(start, bounds2.start);
+			end = Max(end, bounds2.end);
+			return *this;
+		}
+
+		constexpr Bounds2 Extended(const Bounds2& bounds2) const
+		{
+			Bounds2 result;
+			result.start = Min(start, bounds2.start);
+			result.end = Max(end, bounds2.end);
+			return result;
+		}
+
 		constexpr Bounds2& Translate(const Vector2<IntType>& vec2)
 		{
 			start += vec2;
@@ -149,6 +164,21 @@ namespace Quartz
 			return result;
 		}
 
+		constexpr Bounds3& Extend(const Bounds3& bounds3)
+		{
+			start = Min(start, bounds3.start);
+			end = Max(end, bounds3.end);
+			return *this;
+		}
+
+		constexpr Bounds3 Extended(const Bounds3& bounds3) const
+		{
+			Bounds3 result;
+			result.start = Min(start, bounds3.start);
+			result.end = Max(end, bounds3.end);
+			return result;
+		}
+
 		constexpr Bounds3& Translate(const Vector2<IntType>& vec2)
 		{
 			start += vec2;
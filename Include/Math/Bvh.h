@@ -0,0 +1,1511 @@
+#pragma once
+
+#include "Util.h"
+#include "Simd.h"
+#include "Vector.h"
+#include "Bounds.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Quartz
+{
+	/*====================================================
+	|                  QUARTZMATH RAY3                   |
+	=====================================================*/
+
+	template<typename IntType>
+	struct Ray3
+	{
+		Point3<IntType> origin;
+		Vector3<IntType> direction;
+
+		/** Construct a Ray3 at the origin pointing along +z */
+		constexpr Ray3()
+			: origin(0, 0, 0), direction(0, 0, 1) { }
+
+		/** Construct a Ray3 from an origin and a direction */
+		constexpr Ray3(const Point3<IntType>& origin, const Vector3<IntType>& direction)
+			: origin(origin), direction(direction) { }
+
+		/** Get the point at t, in units of direction */
+		constexpr Point3<IntType> At(IntType t) const
+		{
+			return origin + direction * t;
+		}
+	};
+
+	typedef Ray3<float>		Ray3f;
+	typedef Ray3<double>	Ray3d;
+
+	/*====================================================
+	|                   QUARTZMATH BVH                   |
+	=====================================================*/
+
+	// Bvh3 is a binary bounding volume hierarchy over an array of Bounds3f,
+	// built top-down with the binned surface area heuristic: a node bins the
+	// centroids of its primitives into binCount slabs per axis and splits at
+	// the boundary with the lowest SAH cost, or becomes a leaf when it holds
+	// at most maxLeafSize primitives and no split is cheaper.
+	//
+	// Nodes are 32 bytes, a Bounds3f and two indices. The children of an
+	// interior node are adjacent, offset and offset + 1, and a leaf covers
+	// [offset, offset + count) of primitives and primitiveBounds, which are
+	// stored in leaf order. A node is always stored after its parent, so
+	// Refit() updates the tree for moved primitives in one backwards pass.
+	// Refit keeps the topology, rebuild once objects have moved far.
+	//
+	// The build hands subtrees of at least parallelThreshold primitives to
+	// per-worker queues the way NoiseField deals tiles: owners pop from the
+	// front, idle workers steal from the back. Node pairs are claimed with an
+	// atomic counter, so the tree is the serial one with its nodes in another
+	// order. The first splits scan their whole range on one thread, which
+	// bounds the speedup for small trees.
+	//
+	// Queries test the primitive bounds unless given a callback for the exact
+	// shape, called with the original primitive index: hitFunc(index, tMax)
+	// returns true after narrowing tMax to a closer hit, distanceFunc(index)
+	// returns a squared distance. tMax and distanceSquared are the search
+	// limit on input and the result on output. Rays visit the nearest child
+	// first, nearest point queries the closest.
+
+	/** Build settings for Bvh3 */
+	struct BvhParams
+	{
+		uSize threadCount;			// 0 = std::thread::hardware_concurrency()
+		uSize maxLeafSize;			// most primitives a leaf may hold
+		uSize binCount;				// SAH bins per axis, 2 to 64
+		uSize parallelThreshold;	// smallest subtree handed to another worker
+
+		BvhParams(uSize threadCount = 0, uSize maxLeafSize = 4, uSize binCount = 16, uSize parallelThreshold = 4096) :
+			threadCount(threadCount), maxLeafSize(maxLeafSize), binCount(binCount), parallelThreshold(parallelThreshold) {}
+	};
+
+	struct alignas(32) BvhNode
+	{
+		Bounds3f bounds;
+		uInt32 offset;	// First child for interior nodes, first primitive for leaves
+		uInt32 count;	// Primitive count, 0 for interior nodes
+
+		bool IsLeaf() const
+		{
+			return count != 0;
+		}
+	};
+
+	static_assert(sizeof(BvhNode) == 32, "BvhNode must be 32 bytes");
+
+	static constexpr float BVH_INFINITY = std::numeric_limits<float>::infinity();
+
+	/** Bounds that any Extend replaces, and that no query can hit */
+	inline Bounds3f BvhEmptyBounds()
+	{
+		Bounds3f bounds;
+		bounds.start	= Vec3f(BVH_INFINITY);
+		bounds.end		= Vec3f(-BVH_INFINITY);
+		return bounds;
+	}
+
+	/** Half the surface area of a box, the SAH weight */
+	inline float BvhHalfArea(const Bounds3f& bounds)
+	{
+		const Vec3f extent = bounds.end - bounds.start;
+		return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+	}
+
+	/** Check if two boxes overlap, touching counts */
+	inline bool BvhOverlaps(const Bounds3f& a, const Bounds3f& b)
+	{
+		return a.start.x <= b.end.x && a.end.x >= b.start.x &&
+			a.start.y <= b.end.y && a.end.y >= b.start.y &&
+			a.start.z <= b.end.z && a.end.z >= b.start.z;
+	}
+
+	/** Get the squared distance from a point to a box, 0 inside it */
+	inline float BvhDistanceSquared(const Bounds3f& bounds, const Vec3f& point)
+	{
+		const Vec3f delta = Max(Max(bounds.start - point, point - bounds.end), Vec3f(0.0f));
+		return Dot(delta, delta);
+	}
+
+	/** A ray prepared for slab tests: reciprocal direction and the near corner of each axis */
+	struct BvhRay
+	{
+		Vec3f origin;
+		Vec3f inverse;
+		uInt32 nearX, nearY, nearZ;		// 0 to enter through start, 1 through end
+
+		explicit BvhRay(const Ray3f& ray) :
+			origin(ray.origin),
+			inverse(Inverse(ray.direction.x), Inverse(ray.direction.y), Inverse(ray.direction.z)),
+			nearX(inverse.x < 0.0f), nearY(inverse.y < 0.0f), nearZ(inverse.z < 0.0f) {}
+
+		/** Reciprocal that stays finite, so a ray parallel to a slab never computes 0 * inf */
+		static float Inverse(float direction)
+		{
+			return 1.0f / (Abs(direction) > 1e-20f ? direction : 1e-20f);
+		}
+
+		/** Get the distance at which the ray enters a box, infinity if it misses it before tMax */
+		float Enter(const Bounds3f& bounds, float tMax) const
+		{
+			const Vec3f* corners = &bounds.start;
+
+			const float tNear = Max(Max((corners[nearX].x - origin.x) * inverse.x, (corners[nearY].y - origin.y) * inverse.y),
+				Max((corners[nearZ].z - origin.z) * inverse.z, 0.0f));
+			const float tFar = Min(Min((corners[1 - nearX].x - origin.x) * inverse.x, (corners[1 - nearY].y - origin.y) * inverse.y),
+				Min((corners[1 - nearZ].z - origin.z) * inverse.z, tMax));
+
+			return tNear <= tFar ? tNear : BVH_INFINITY;
+		}
+	};
+
+	struct BvhStackEntry
+	{
+		uInt32 node;
+		float key;		// Entry distance or squared distance, to skip nodes the search has passed
+	};
+
+	/** Traversal stack, kept on the stack unless the tree is unusually deep */
+	struct BvhStack
+	{
+		static constexpr uSize LOCAL_SIZE = 128;
+
+		BvhStackEntry				local[LOCAL_SIZE];
+		std::vector<BvhStackEntry>	heap;
+		BvhStackEntry*				entries;
+		uSize						size;
+
+		explicit BvhStack(uSize capacity) :
+			entries(local), size(0)
+		{
+			if (capacity > LOCAL_SIZE)
+			{
+				heap.resize(capacity);
+				entries = heap.data();
+			}
+		}
+
+		void Push(uInt32 node, float key)
+		{
+			entries[size++] = { node, key };
+		}
+
+		bool Pop(uInt32& node, float& key)
+		{
+			if (size == 0)
+			{
+				return false;
+			}
+
+			size--;
+			node	= entries[size].node;
+			key		= entries[size].key;
+			return true;
+		}
+	};
+
+	/** A subtree still to be built, with the bounds of its primitives and of their centroids */
+	struct BvhBuildTask
+	{
+		uInt32 node;
+		uInt32 begin;
+		uInt32 end;
+		uInt32 depth;
+		Bounds3f bounds;
+		Bounds3f centroidBounds;
+	};
+
+	/** A worker's build queue. The owner pops from the front, thieves take from the back */
+	struct BvhTaskQueue
+	{
+		std::mutex					mutex;
+		std::deque<BvhBuildTask>	tasks;
+
+		void Push(const BvhBuildTask& task)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			tasks.push_back(task);
+		}
+
+		bool Pop(BvhBuildTask& task)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (tasks.empty())
+			{
+				return false;
+			}
+
+			task = tasks.front();
+			tasks.pop_front();
+			return true;
+		}
+
+		bool Steal(BvhBuildTask& task)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (tasks.empty())
+			{
+				return false;
+			}
+
+			task = tasks.back();
+			tasks.pop_back();
+			return true;
+		}
+	};
+
+	/** Binned SAH builder shared by the build workers */
+	struct BvhBuilder
+	{
+		static constexpr uSize MAX_BINS = 64;
+
+		struct Bin
+		{
+			Bounds3f bounds;
+			uInt32 count;
+		};
+
+		const Bounds3f*		bounds;
+		const BvhParams&	params;
+		uInt32*				indices;
+		BvhNode*			nodes;
+		std::vector<Vec3f>	centroids;
+		uSize				binCount;
+
+		std::atomic<uInt32>	nodeCount;
+		std::atomic<uInt32>	depth;
+		std::atomic<uSize>	pendingTasks;
+
+		BvhBuilder(const Bounds3f* bounds, uSize count, const BvhParams& params, uInt32* indices, BvhNode* nodes) :
+			bounds(bounds), params(params), indices(indices), nodes(nodes), centroids(count),
+			binCount(Clamp<uSize>(2, MAX_BINS, params.binCount)),
+			nodeCount(1), depth(0), pendingTasks(0)
+		{
+			for (uSize i = 0; i < count; i++)
+			{
+				centroids[i] = (bounds[i].start + bounds[i].end) * 0.5f;
+			}
+		}
+
+		/** Set the bounds of the range begin to end */
+		void RangeBounds(BvhBuildTask& task) const
+		{
+			task.bounds			= BvhEmptyBounds();
+			task.centroidBounds	= BvhEmptyBounds();
+
+			for (uInt32 i = task.begin; i < task.end; i++)
+			{
+				task.bounds.Extend(bounds[indices[i]]);
+				task.centroidBounds.Extend(centroids[indices[i]]);
+			}
+		}
+
+		/** Fill in a task's node as a leaf, or partition its range into left and right and return true */
+		bool Split(const BvhBuildTask& task, Bin* bins, BvhBuildTask& left, BvhBuildTask& right)
+		{
+			const uInt32 count = task.end - task.begin;
+
+			nodes[task.node].bounds	= task.bounds;
+			nodes[task.node].offset	= task.begin;
+			nodes[task.node].count	= count;
+
+			if (count <= 1)
+			{
+				return false;
+			}
+
+			// More bins than primitives cannot find a better split, bins holds 3 * nodeBins
+			const uSize nodeBins = Min<uSize>(binCount, count);
+			const Vec3f origin = task.centroidBounds.start;
+			const Vec3f extent = task.centroidBounds.end - origin;
+
+			float scale[3];
+
+			for (uSize axis = 0; axis < 3; axis++)
+			{
+				// Shrunk slightly so the largest centroid lands in the last bin
+				scale[axis] = extent[(int)axis] > 0.0f ? (float)nodeBins * 0.99999f / extent[(int)axis] : 0.0f;
+
+				for (uSize bin = 0; bin < nodeBins; bin++)
+				{
+					bins[axis * nodeBins + bin].bounds	= BvhEmptyBounds();
+					bins[axis * nodeBins + bin].count	= 0;
+				}
+			}
+
+			for (uInt32 i = task.begin; i < task.end; i++)
+			{
+				// Copied, the bin stores could alias the inputs
+				const Bounds3f primitive	= bounds[indices[i]];
+				const Vec3f offset			= centroids[indices[i]] - origin;
+
+				for (uSize axis = 0; axis < 3; axis++)
+				{
+					Bin& bin = bins[axis * nodeBins + (uSize)(offset[(int)axis] * scale[axis])];
+					bin.bounds.Extend(primitive);
+					bin.count++;
+				}
+			}
+
+			// Sweep right to left for the cost of every right side, then left to right for the total
+			float bestCost	= BVH_INFINITY;
+			uSize bestAxis	= 3;
+			uSize bestBin	= 0;
+
+			for (uSize axis = 0; axis < 3; axis++)
+			{
+				if (scale[axis] == 0.0f)
+				{
+					continue;
+				}
+
+				const Bin* axisBins = bins + axis * nodeBins;
+				float rightCost[MAX_BINS];
+				Bounds3f side		= BvhEmptyBounds();
+				uInt32 sideCount	= 0;
+
+				for (uSize bin = nodeBins - 1; bin > 0; bin--)
+				{
+					side.Extend(axisBins[bin].bounds);
+					sideCount += axisBins[bin].count;
+					rightCost[bin] = sideCount ? BvhHalfArea(side) * (float)sideCount : BVH_INFINITY;
+				}
+
+				side		= BvhEmptyBounds();
+				sideCount	= 0;
+
+				for (uSize bin = 0; bin < nodeBins - 1; bin++)
+				{
+					side.Extend(axisBins[bin].bounds);
+					sideCount += axisBins[bin].count;
+
+					const float cost = sideCount ? BvhHalfArea(side) * (float)sideCount + rightCost[bin + 1] : BVH_INFINITY;
+
+					if (cost < bestCost)
+					{
+						bestCost	= cost;
+						bestAxis	= axis;
+						bestBin		= bin + 1;
+					}
+				}
+			}
+
+			// Traversing a node and testing a primitive both cost 1
+			const float splitCost = 1.0f + bestCost / Max(BvhHalfArea(task.bounds), std::numeric_limits<float>::min());
+
+			if (count <= params.maxLeafSize && (bestAxis == 3 || splitCost >= (float)count))
+			{
+				return false;
+			}
+
+			left.begin	= task.begin;
+			right.end	= task.end;
+
+			if (bestAxis == 3)
+			{
+				// Every centroid is the same point, any split is as good
+				left.end	= task.begin + count / 2;
+				right.begin	= left.end;
+
+				RangeBounds(left);
+				RangeBounds(right);
+				return true;
+			}
+
+			// The child bounds are the bins on either side, the centroid bounds are gathered while partitioning
+			const Bin* axisBins = bins + bestAxis * nodeBins;
+
+			Bounds3f leftCentroids	= BvhEmptyBounds();
+			Bounds3f rightCentroids	= BvhEmptyBounds();
+
+			left.bounds		= BvhEmptyBounds();
+			right.bounds	= BvhEmptyBounds();
+
+			for (uSize bin = 0; bin < nodeBins; bin++)
+			{
+				(bin < bestBin ? left : right).bounds.Extend(axisBins[bin].bounds);
+			}
+
+			const float axisStart	= origin[(int)bestAxis];
+			const float axisScale	= scale[bestAxis];
+
+			uInt32 first	= task.begin;
+			uInt32 last		= task.end;
+
+			while (first < last)
+			{
+				const Vec3f centroid = centroids[indices[first]];
+
+				if ((uSize)((centroid[(int)bestAxis] - axisStart) * axisScale) < bestBin)
+				{
+					leftCentroids.Extend(centroid);
+					first++;
+				}
+				else
+				{
+					rightCentroids.Extend(centroid);
+					std::swap(indices[first], indices[--last]);
+				}
+			}
+
+			left.centroidBounds		= leftCentroids;
+			right.centroidBounds	= rightCentroids;
+			left.end	= first;
+			right.begin	= first;
+			return true;
+		}
+
+		/** Build a subtree, handing large right children to queue when there is one */
+		void Build(const BvhBuildTask& root, BvhTaskQueue* queue)
+		{
+			std::vector<BvhBuildTask> stack;
+			std::vector<Bin> bins(3 * binCount);
+			stack.push_back(root);
+
+			uInt32 maxDepth = 0;
+
+			while (!stack.empty())
+			{
+				const BvhBuildTask task = stack.back();
+				stack.pop_back();
+
+				maxDepth = Max(maxDepth, task.depth);
+
+				BvhBuildTask left, right;
+
+				if (!Split(task, bins.data(), left, right))
+				{
+					continue;
+				}
+
+				const uInt32 child = nodeCount.fetch_add(2, std::memory_order_relaxed);
+
+				nodes[task.node].offset	= child;
+				nodes[task.node].count	= 0;
+
+				left.node	= child;
+				right.node	= child + 1;
+				left.depth	= task.depth + 1;
+				right.depth	= task.depth + 1;
+
+				if (queue && right.end - right.begin >= params.parallelThreshold)
+				{
+					pendingTasks.fetch_add(1);
+					queue->Push(right);
+				}
+				else
+				{
+					stack.push_back(right);
+				}
+
+				stack.push_back(left);
+			}
+
+			uInt32 current = depth.load();
+
+			while (current < maxDepth && !depth.compare_exchange_weak(current, maxDepth)) {}
+		}
+
+		/** Build the whole tree into nodes, returning the node count */
+		uInt32 Run(uSize count)
+		{
+			BvhBuildTask root;
+			root.node	= 0;
+			root.begin	= 0;
+			root.end	= (uInt32)count;
+			root.depth	= 1;
+			RangeBounds(root);
+
+			uSize threadCount = params.threadCount ? params.threadCount : (uSize)std::thread::hardware_concurrency();
+			threadCount = Clamp<uSize>(1, Max<uSize>(1, count / Max<uSize>(1, params.parallelThreshold)), threadCount);
+
+			if (threadCount == 1)
+			{
+				Build(root, nullptr);
+				return nodeCount.load();
+			}
+
+			std::vector<BvhTaskQueue> queues(threadCount);
+
+			pendingTasks = 1;
+			queues[0].Push(root);
+
+			// pendingTasks counts queued and running tasks, a task is only pushed by a running one
+			auto worker = [&](uSize index)
+			{
+				BvhBuildTask task;
+
+				for (;;)
+				{
+					bool found = queues[index].Pop(task);
+
+					for (uSize offset = 1; offset < threadCount && !found; offset++)
+					{
+						found = queues[(index + offset) % threadCount].Steal(task);
+					}
+
+					if (found)
+					{
+						Build(task, &queues[index]);
+						pendingTasks.fetch_sub(1);
+					}
+					else if (pendingTasks.load() == 0)
+					{
+						return;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+			};
+
+			std::vector<std::thread> threads;
+			threads.reserve(threadCount - 1);
+
+			for (uSize index = 1; index < threadCount; index++)
+			{
+				threads.emplace_back(worker, index);
+			}
+
+			worker(0);
+
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+
+			return nodeCount.load();
+		}
+	};
+
+	struct Bvh3
+	{
+		std::vector<BvhNode>	nodes;
+		std::vector<uInt32>		primitives;			// Original index of each primitive, in leaf order
+		std::vector<Bounds3f>	primitiveBounds;	// Bounds of each primitive, in leaf order
+		uSize					depth;				// Levels below and including the root
+
+		/** Construct an empty Bvh3 */
+		Bvh3() :
+			depth(0) { }
+
+		/** Construct a Bvh3 over count boxes */
+		Bvh3(const Bounds3f* bounds, uSize count, const BvhParams& params = BvhParams()) :
+			depth(0)
+		{
+			Build(bounds, count, params);
+		}
+
+		/** Number of primitives */
+		uSize Size() const
+		{
+			return primitives.size();
+		}
+
+		/** Get the bounds of every primitive, empty bounds for an empty tree */
+		Bounds3f GetBounds() const
+		{
+			return nodes.empty() ? BvhEmptyBounds() : nodes[0].bounds;
+		}
+
+		/** Build the tree over count boxes, replacing any previous one */
+		void Build(const Bounds3f* bounds, uSize count, const BvhParams& params = BvhParams())
+		{
+			nodes.clear();
+			primitives.resize(count);
+			primitiveBounds.resize(count);
+			depth = 0;
+
+			if (count == 0)
+			{
+				return;
+			}
+
+			for (uSize i = 0; i < count; i++)
+			{
+				primitives[i] = (uInt32)i;
+			}
+
+			nodes.resize(2 * count - 1);
+
+			BvhBuilder builder(bounds, count, params, primitives.data(), nodes.data());
+
+			nodes.resize(builder.Run(count));
+			depth = builder.depth.load();
+
+			for (uSize i = 0; i < count; i++)
+			{
+				primitiveBounds[i] = bounds[primitives[i]];
+			}
+		}
+
+		/** Update the node bounds for new primitive bounds, indexed as in Build() */
+		void Refit(const Bounds3f* bounds)
+		{
+			for (uSize i = 0; i < primitives.size(); i++)
+			{
+				primitiveBounds[i] = bounds[primitives[i]];
+			}
+
+			for (uSize i = nodes.size(); i-- > 0;)
+			{
+				BvhNode& node = nodes[i];
+
+				if (node.IsLeaf())
+				{
+					node.bounds = primitiveBounds[node.offset];
+
+					for (uInt32 j = 1; j < node.count; j++)
+					{
+						node.bounds.Extend(primitiveBounds[node.offset + j]);
+					}
+				}
+				else
+				{
+					node.bounds = nodes[node.offset].bounds.Extended(nodes[node.offset + 1].bounds);
+				}
+			}
+		}
+
+		/** Find the closest primitive box the ray enters before tMax, narrowing tMax to its entry distance */
+		bool Raycast(const Ray3f& ray, float& tMax, uInt32& hitIndex) const
+		{
+			const BvhRay bvhRay(ray);
+
+			return RaycastLeaves(bvhRay, tMax, [&](uInt32 primitive, float& t)
+			{
+				const float enter = bvhRay.Enter(primitiveBounds[primitive], t);
+
+				if (enter < t)
+				{
+					t			= enter;
+					hitIndex	= primitives[primitive];
+					return true;
+				}
+
+				return false;
+			});
+		}
+
+		/** Find the closest hit before tMax with hitFunc(index, tMax) for the primitives whose box the ray enters */
+		template<typename HitFunc>
+		bool Raycast(const Ray3f& ray, float& tMax, uInt32& hitIndex, HitFunc hitFunc) const
+		{
+			return RaycastLeaves(BvhRay(ray), tMax, [&](uInt32 primitive, float& t)
+			{
+				if (hitFunc(primitives[primitive], t))
+				{
+					hitIndex = primitives[primitive];
+					return true;
+				}
+
+				return false;
+			});
+		}
+
+		/** Call func(index) for every primitive whose box overlaps bounds */
+		template<typename Func>
+		void QueryOverlap(const Bounds3f& bounds, Func func) const
+		{
+			if (nodes.empty() || !BvhOverlaps(nodes[0].bounds, bounds))
+			{
+				return;
+			}
+
+			BvhStack stack(depth + 1);
+			uInt32 index = 0;
+			float key;
+
+			do
+			{
+				const BvhNode& node = nodes[index];
+
+				if (node.IsLeaf())
+				{
+					for (uInt32 i = node.offset; i < node.offset + node.count; i++)
+					{
+						if (BvhOverlaps(primitiveBounds[i], bounds))
+						{
+							func(primitives[i]);
+						}
+					}
+
+					continue;
+				}
+
+				for (uInt32 child = node.offset; child < node.offset + 2; child++)
+				{
+					if (BvhOverlaps(nodes[child].bounds, bounds))
+					{
+						stack.Push(child, 0.0f);
+					}
+				}
+			}
+			while (stack.Pop(index, key));
+		}
+
+		/** Store the indices of the primitives whose box overlaps bounds, returning their count */
+		uSize QueryOverlap(const Bounds3f& bounds, std::vector<uInt32>& results) const
+		{
+			results.clear();
+			QueryOverlap(bounds, [&](uInt32 index) { results.push_back(index); });
+			return results.size();
+		}
+
+		/** Find the primitive box closest to point within distanceSquared, narrowing it */
+		bool QueryNearest(const Vec3f& point, float& distanceSquared, uInt32& nearestIndex) const
+		{
+			return NearestLeaves(point, distanceSquared, [&](uInt32 primitive, float& best)
+			{
+				const float distance = BvhDistanceSquared(primitiveBounds[primitive], point);
+
+				if (distance < best)
+				{
+					best			= distance;
+					nearestIndex	= primitives[primitive];
+					return true;
+				}
+
+				return false;
+			});
+		}
+
+		/** Find the primitive closest to point within distanceSquared by distanceFunc(index), narrowing it */
+		template<typename DistanceFunc>
+		bool QueryNearest(const Vec3f& point, float& distanceSquared, uInt32& nearestIndex, DistanceFunc distanceFunc) const
+		{
+			return NearestLeaves(point, distanceSquared, [&](uInt32 primitive, float& best)
+			{
+				const float distance = distanceFunc(primitives[primitive]);
+
+				if (distance < best)
+				{
+					best			= distance;
+					nearestIndex	= primitives[primitive];
+					return true;
+				}
+
+				return false;
+			});
+		}
+
+		/** Ray traversal calling leafFunc(primitive, tMax) for the primitives of every leaf entered */
+		template<typename LeafFunc>
+		bool RaycastLeaves(const BvhRay& ray, float& tMax, LeafFunc leafFunc) const
+		{
+			if (nodes.empty() || ray.Enter(nodes[0].bounds, tMax) == BVH_INFINITY)
+			{
+				return false;
+			}
+
+			BvhStack stack(depth + 1);
+			uInt32 index = 0;
+			float enter = 0.0f;
+			bool hit = false;
+
+			do
+			{
+				if (enter >= tMax)
+				{
+					continue;
+				}
+
+				for (;;)
+				{
+					const BvhNode& node = nodes[index];
+
+					if (node.IsLeaf())
+					{
+						for (uInt32 i = node.offset; i < node.offset + node.count; i++)
+						{
+							hit |= leafFunc(i, tMax);
+						}
+
+						break;
+					}
+
+					uInt32 nearChild	= node.offset;
+					uInt32 farChild		= node.offset + 1;
+					float nearEnter		= ray.Enter(nodes[nearChild].bounds, tMax);
+					float farEnter		= ray.Enter(nodes[farChild].bounds, tMax);
+
+					if (farEnter < nearEnter)
+					{
+						std::swap(nearChild, farChild);
+						std::swap(nearEnter, farEnter);
+					}
+
+					if (nearEnter == BVH_INFINITY)
+					{
+						break;
+					}
+
+					if (farEnter != BVH_INFINITY)
+					{
+						stack.Push(farChild, farEnter);
+					}
+
+					index = nearChild;
+				}
+			}
+			while (stack.Pop(index, enter));
+
+			return hit;
+		}
+
+		/** Nearest point traversal calling leafFunc(primitive, distanceSquared) for the leaves within reach */
+		template<typename LeafFunc>
+		bool NearestLeaves(const Vec3f& point, float& distanceSquared, LeafFunc leafFunc) const
+		{
+			if (nodes.empty() || !(BvhDistanceSquared(nodes[0].bounds, point) < distanceSquared))
+			{
+				return false;
+			}
+
+			BvhStack stack(depth + 1);
+			uInt32 index = 0;
+			float distance = 0.0f;
+			bool found = false;
+
+			do
+			{
+				if (distance >= distanceSquared)
+				{
+					continue;
+				}
+
+				for (;;)
+				{
+					const BvhNode& node = nodes[index];
+
+					if (node.IsLeaf())
+					{
+						for (uInt32 i = node.offset; i < node.offset + node.count; i++)
+						{
+							found |= leafFunc(i, distanceSquared);
+						}
+
+						break;
+					}
+
+					uInt32 nearChild	= node.offset;
+					uInt32 farChild		= node.offset + 1;
+					float nearDistance	= BvhDistanceSquared(nodes[nearChild].bounds, point);
+					float farDistance	= BvhDistanceSquared(nodes[farChild].bounds, point);
+
+					if (farDistance < nearDistance)
+					{
+						std::swap(nearChild, farChild);
+						std::swap(nearDistance, farDistance);
+					}
+
+					if (!(nearDistance < distanceSquared))
+					{
+						break;
+					}
+
+					if (farDistance < distanceSquared)
+					{
+						stack.Push(farChild, farDistance);
+					}
+
+					index = nearChild;
+				}
+			}
+			while (stack.Pop(index, distance));
+
+			return found;
+		}
+	};
+
+	/*====================================================
+	|                 QUARTZMATH WIDE BVH                |
+	=====================================================*/
+
+	// Bvh3Wide<Width> collapses a built Bvh3 into nodes of Width children, 4
+	// or 8: starting from a binary node's two children, the interior child
+	// with the largest area is replaced by its own two until there are Width.
+	// Child boxes are stored as lanes, so a node visit tests every child at
+	// once, four lanes at a time with SSE. A 4-wide node is 128 bytes, two
+	// cache lines, against four 32-byte binary nodes over three levels.
+	//
+	// Unused slots have empty bounds (start +inf, end -inf) that fail every
+	// test, including the sign-selected slab test. Primitives keep the leaf
+	// order of the Bvh3 and the queries, callbacks and Refit match Bvh3.
+	//
+	// Ray casts and overlap queries are where the wide nodes pay off. A
+	// nearest point query narrows its radius fastest by descending to one
+	// leaf, which the binary tree does with a node per level, while a wide
+	// node measures every child first. With SIMD off QueryNearest on Bvh3x4
+	// is about 1.6x slower than on Bvh3, and with SIMD on it ranges from 20%
+	// faster to 30% slower depending on the machine, so nearest point
+	// queries should use the Bvh3 the wide tree was collapsed from.
+
+	template<uSize Width>
+	struct alignas(32) BvhWideNode
+	{
+		static_assert(Width == 4 || Width == 8, "BvhWideNode is 4 or 8 wide");
+
+		static constexpr uInt32 EMPTY = 0xFFFFFFFFu;
+
+		float startX[Width];
+		float startY[Width];
+		float startZ[Width];
+		float endX[Width];
+		float endY[Width];
+		float endZ[Width];
+		uInt32 offset[Width];	// Child node for interior children, first primitive for leaves, EMPTY if unused
+		uInt32 count[Width];	// Primitive count, 0 for interior children
+
+		/** Construct a node with every slot unused */
+		BvhWideNode()
+		{
+			for (uSize slot = 0; slot < Width; slot++)
+			{
+				SetBounds(slot, BvhEmptyBounds());
+				offset[slot]	= EMPTY;
+				count[slot]		= 0;
+			}
+		}
+
+		/** Get the box of a slot */
+		Bounds3f GetBounds(uSize slot) const
+		{
+			Bounds3f bounds;
+			bounds.start	= Vec3f(startX[slot], startY[slot], startZ[slot]);
+			bounds.end		= Vec3f(endX[slot], endY[slot], endZ[slot]);
+			return bounds;
+		}
+
+		/** Set the box of a slot */
+		void SetBounds(uSize slot, const Bounds3f& bounds)
+		{
+			startX[slot]	= bounds.start.x;
+			startY[slot]	= bounds.start.y;
+			startZ[slot]	= bounds.start.z;
+			endX[slot]		= bounds.end.x;
+			endY[slot]		= bounds.end.y;
+			endZ[slot]		= bounds.end.z;
+		}
+
+		/** Bit i set for each child the ray enters before tMax, with its entry distance in enter[i] */
+		uInt32 IntersectRay(const BvhRay& ray, float tMax, float* enter) const
+		{
+			const float* nearX	= ray.nearX ? endX : startX;
+			const float* farX	= ray.nearX ? startX : endX;
+			const float* nearY	= ray.nearY ? endY : startY;
+			const float* farY	= ray.nearY ? startY : endY;
+			const float* nearZ	= ray.nearZ ? endZ : startZ;
+			const float* farZ	= ray.nearZ ? startZ : endZ;
+
+			uInt32 mask = 0;
+
+		#if QMATH_SSE2
+			const __m128 ox		= _mm_set1_ps(ray.origin.x);
+			const __m128 oy		= _mm_set1_ps(ray.origin.y);
+			const __m128 oz		= _mm_set1_ps(ray.origin.z);
+			const __m128 ix		= _mm_set1_ps(ray.inverse.x);
+			const __m128 iy		= _mm_set1_ps(ray.inverse.y);
+			const __m128 iz		= _mm_set1_ps(ray.inverse.z);
+			const __m128 zero	= _mm_setzero_ps();
+			const __m128 limit	= _mm_set1_ps(tMax);
+
+			for (uSize i = 0; i < Width; i += 4)
+			{
+				const __m128 tNear = _mm_max_ps(
+					_mm_max_ps(_mm_mul_ps(_mm_sub_ps(Simd::Load4(nearX + i), ox), ix), _mm_mul_ps(_mm_sub_ps(Simd::Load4(nearY + i), oy), iy)),
+					_mm_max_ps(_mm_mul_ps(_mm_sub_ps(Simd::Load4(nearZ + i), oz), iz), zero));
+				const __m128 tFar = _mm_min_ps(
+					_mm_min_ps(_mm_mul_ps(_mm_sub_ps(Simd::Load4(farX + i), ox), ix), _mm_mul_ps(_mm_sub_ps(Simd::Load4(farY + i), oy), iy)),
+					_mm_min_ps(_mm_mul_ps(_mm_sub_ps(Simd::Load4(farZ + i), oz), iz), limit));
+
+				mask |= (uInt32)_mm_movemask_ps(_mm_cmple_ps(tNear, tFar)) << i;
+				Simd::Store4(enter + i, tNear);
+			}
+		#else
+			for (uSize i = 0; i < Width; i++)
+			{
+				const float tNear = Max(Max((nearX[i] - ray.origin.x) * ray.inverse.x, (nearY[i] - ray.origin.y) * ray.inverse.y),
+					Max((nearZ[i] - ray.origin.z) * ray.inverse.z, 0.0f));
+				const float tFar = Min(Min((farX[i] - ray.origin.x) * ray.inverse.x, (farY[i] - ray.origin.y) * ray.inverse.y),
+					Min((farZ[i] - ray.origin.z) * ray.inverse.z, tMax));
+
+				mask |= (uInt32)(tNear <= tFar) << i;
+				enter[i] = tNear;
+			}
+		#endif
+
+			return mask;
+		}
+
+		/** Bit i set for each child overlapping bounds */
+		uInt32 IntersectBounds(const Bounds3f& bounds) const
+		{
+			uInt32 mask = 0;
+
+		#if QMATH_SSE2
+			const __m128 sx = _mm_set1_ps(bounds.start.x);
+			const __m128 sy = _mm_set1_ps(bounds.start.y);
+			const __m128 sz = _mm_set1_ps(bounds.start.z);
+			const __m128 ex = _mm_set1_ps(bounds.end.x);
+			const __m128 ey = _mm_set1_ps(bounds.end.y);
+			const __m128 ez = _mm_set1_ps(bounds.end.z);
+
+			for (uSize i = 0; i < Width; i += 4)
+			{
+				const __m128 x = _mm_and_ps(_mm_cmple_ps(Simd::Load4(startX + i), ex), _mm_cmpge_ps(Simd::Load4(endX + i), sx));
+				const __m128 y = _mm_and_ps(_mm_cmple_ps(Simd::Load4(startY + i), ey), _mm_cmpge_ps(Simd::Load4(endY + i), sy));
+				const __m128 z = _mm_and_ps(_mm_cmple_ps(Simd::Load4(startZ + i), ez), _mm_cmpge_ps(Simd::Load4(endZ + i), sz));
+
+				mask |= (uInt32)_mm_movemask_ps(_mm_and_ps(_mm_and_ps(x, y), z)) << i;
+			}
+		#else
+			for (uSize i = 0; i < Width; i++)
+			{
+				mask |= (uInt32)BvhOverlaps(GetBounds(i), bounds) << i;
+			}
+		#endif
+
+			return mask;
+		}
+
+		/** Bit i set for each child closer to point than distanceSquared, with its squared distance in distance[i] */
+		uInt32 IntersectPoint(const Vec3f& point, float distanceSquared, float* distance) const
+		{
+			uInt32 mask = 0;
+
+		#if QMATH_SSE2
+			const __m128 px		= _mm_set1_ps(point.x);
+			const __m128 py		= _mm_set1_ps(point.y);
+			const __m128 pz		= _mm_set1_ps(point.z);
+			const __m128 zero	= _mm_setzero_ps();
+			const __m128 limit	= _mm_set1_ps(distanceSquared);
+
+			for (uSize i = 0; i < Width; i += 4)
+			{
+				const __m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(Simd::Load4(startX + i), px), _mm_sub_ps(px, Simd::Load4(endX + i))), zero);
+				const __m128 dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(Simd::Load4(startY + i), py), _mm_sub_ps(py, Simd::Load4(endY + i))), zero);
+				const __m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(Simd::Load4(startZ + i), pz), _mm_sub_ps(pz, Simd::Load4(endZ + i))), zero);
+				const __m128 d = Simd::MulAdd4(dz, dz, Simd::MulAdd4(dy, dy, _mm_mul_ps(dx, dx)));
+
+				mask |= (uInt32)_mm_movemask_ps(_mm_cmplt_ps(d, limit)) << i;
+				Simd::Store4(distance + i, d);
+			}
+		#else
+			for (uSize i = 0; i < Width; i++)
+			{
+				distance[i] = BvhDistanceSquared(GetBounds(i), point);
+				mask |= (uInt32)(distance[i] < distanceSquared) << i;
+			}
+		#endif
+
+			return mask;
+		}
+	};
+
+	static_assert(sizeof(BvhWideNode<4>) == 128, "BvhWideNode<4> must be 128 bytes");
+
+	template<uSize Width>
+	struct Bvh3Wide
+	{
+		using Node = BvhWideNode<Width>;
+
+		std::vector<Node>		nodes;
+		std::vector<uInt32>		primitives;			// Original index of each primitive, in leaf order
+		std::vector<Bounds3f>	primitiveBounds;	// Bounds of each primitive, in leaf order
+		uSize					depth;				// Levels below and including the root
+
+		/** Construct an empty Bvh3Wide */
+		Bvh3Wide() :
+			depth(0) { }
+
+		/** Construct a Bvh3Wide by collapsing a Bvh3 */
+		explicit Bvh3Wide(const Bvh3& bvh) :
+			depth(0)
+		{
+			Build(bvh);
+		}
+
+		/** Construct a Bvh3Wide over count boxes */
+		Bvh3Wide(const Bounds3f* bounds, uSize count, const BvhParams& params = BvhParams()) :
+			depth(0)
+		{
+			Build(Bvh3(bounds, count, params));
+		}
+
+		/** Number of primitives */
+		uSize Size() const
+		{
+			return primitives.size();
+		}
+
+		/** Build by collapsing a Bvh3, replacing any previous tree */
+		void Build(const Bvh3& bvh)
+		{
+			nodes.clear();
+			primitives		= bvh.primitives;
+			primitiveBounds	= bvh.primitiveBounds;
+			depth			= 0;
+
+			if (bvh.nodes.empty())
+			{
+				return;
+			}
+
+			// Binary node to collapse into each wide node, wide nodes are added before their children
+			struct Collapse
+			{
+				uInt32 node;
+				uInt32 source;
+				uInt32 depth;
+			};
+
+			std::vector<Collapse> pending;
+			pending.push_back({ 0, 0, 1 });
+			nodes.emplace_back();
+
+			while (!pending.empty())
+			{
+				const Collapse task = pending.back();
+				pending.pop_back();
+
+				depth = Max<uSize>(depth, task.depth);
+
+				const BvhNode& source = bvh.nodes[task.source];
+
+				uInt32 children[Width];
+				uSize childCount = 0;
+
+				if (source.IsLeaf())
+				{
+					children[childCount++] = task.source;
+				}
+				else
+				{
+					children[childCount++] = source.offset;
+					children[childCount++] = source.offset + 1;
+				}
+
+				while (childCount < Width)
+				{
+					uSize largest = Width;
+					float largestArea = -1.0f;
+
+					for (uSize i = 0; i < childCount; i++)
+					{
+						const BvhNode& child = bvh.nodes[children[i]];
+
+						if (!child.IsLeaf() && BvhHalfArea(child.bounds) > largestArea)
+						{
+							largest		= i;
+							largestArea	= BvhHalfArea(child.bounds);
+						}
+					}
+
+					if (largest == Width)
+					{
+						break;
+					}
+
+					const uInt32 expanded = bvh.nodes[children[largest]].offset;
+					children[largest]			= expanded;
+					children[childCount++]		= expanded + 1;
+				}
+
+				for (uSize slot = 0; slot < childCount; slot++)
+				{
+					const BvhNode& child = bvh.nodes[children[slot]];
+
+					nodes[task.node].SetBounds(slot, child.bounds);
+
+					if (child.IsLeaf())
+					{
+						nodes[task.node].offset[slot]	= child.offset;
+						nodes[task.node].count[slot]	= child.count;
+					}
+					else
+					{
+						const uInt32 index = (uInt32)nodes.size();
+						nodes.emplace_back();
+
+						nodes[task.node].offset[slot]	= index;
+						nodes[task.node].count[slot]	= 0;
+
+						pending.push_back({ index, children[slot], task.depth + 1 });
+					}
+				}
+			}
+		}
+
+		/** Update the node bounds for new primitive bounds, indexed as in Build() */
+		void Refit(const Bounds3f* bounds)
+		{
+			for (uSize i = 0; i < primitives.size(); i++)
+			{
+				primitiveBounds[i] = bounds[primitives[i]];
+			}
+
+			for (uSize i = nodes.size(); i-- > 0;)
+			{
+				Node& node = nodes[i];
+
+				for (uSize slot = 0; slot < Width && node.offset[slot] != Node::EMPTY; slot++)
+				{
+					Bounds3f slotBounds = BvhEmptyBounds();
+
+					if (node.count[slot])
+					{
+						for (uInt32 j = 0; j < node.count[slot]; j++)
+						{
+							slotBounds.Extend(primitiveBounds[node.offset[slot] + j]);
+						}
+					}
+					else
+					{
+						const Node& child = nodes[node.offset[slot]];
+
+						for (uSize childSlot = 0; childSlot < Width && child.offset[childSlot] != Node::EMPTY; childSlot++)
+						{
+							slotBounds.Extend(child.GetBounds(childSlot));
+						}
+					}
+
+					node.SetBounds(slot, slotBounds);
+				}
+			}
+		}
+
+		/** Find the closest primitive box the ray enters before tMax, narrowing tMax to its entry distance */
+		bool Raycast(const Ray3f& ray, float& tMax, uInt32& hitIndex) const
+		{
+			const BvhRay bvhRay(ray);
+
+			return RaycastLeaves(bvhRay, tMax, [&](uInt32 primitive, float& t)
+			{
+				const float enter = bvhRay.Enter(primitiveBounds[primitive], t);
+
+				if (enter < t)
+				{
+					t			= enter;
+					hitIndex	= primitives[primitive];
+					return true;
+				}
+
+				return false;
+			});
+		}
+
+		/** Find the closest hit before tMax with hitFunc(index, tMax) for the primitives whose box the ray enters */
+		template<typename HitFunc>
+		bool Raycast(const Ray3f& ray, float& tMax, uInt32& hitIndex, HitFunc hitFunc) const
+		{
+			return RaycastLeaves(BvhRay(ray), tMax, [&](uInt32 primitive, float& t)
+			{
+				if (hitFunc(primitives[primitive], t))
+				{
+					hitIndex = primitives[primitive];
+					return true;
+				}
+
+				return false;
+			});
+		}
+
+		/** Call func(index) for every primitive whose box overlaps bounds */
+		template<typename Func>
+		void QueryOverlap(const Bounds3f& bounds, Func func) const
+		{
+			if (nodes.empty())
+			{
+				return;
+			}
+
+			BvhStack stack((Width - 1) * depth + 1);
+			uInt32 index = 0;
+			float key;
+
+			do
+			{
+				const Node& node = nodes[index];
+
+				for (uInt32 mask = node.IntersectBounds(bounds); mask; mask &= mask - 1)
+				{
+					const uSize slot = CountTrailingZeros(mask);
+
+					if (node.count[slot])
+					{
+						for (uInt32 i = node.offset[slot]; i < node.offset[slot] + node.count[slot]; i++)
+						{
+							if (BvhOverlaps(primitiveBounds[i], bounds))
+							{
+								func(primitives[i]);
+							}
+						}
+					}
+					else
+					{
+						stack.Push(node.offset[slot], 0.0f);
+					}
+				}
+			}
+			while (stack.Pop(index, key));
+		}
+
+		/** Store the indices of the primitives whose box overlaps bounds, returning their count */
+		uSize QueryOverlap(const Bounds3f& bounds, std::vector<uInt32>& results) const
+		{
+			results.clear();
+			QueryOverlap(bounds, [&](uInt32 index) { results.push_back(index); });
+			return results.size();
+		}
+
+		/** Find the primitive box closest to point within distanceSquared, narrowing it (prefer Bvh3, see above) */
+		bool QueryNearest(const Vec3f& point, float& distanceSquared, uInt32& nearestIndex) const
+		{
+			return NearestLeaves(point, distanceSquared, [&](uInt32 primitive, float& best)
+			{
+				const float distance = BvhDistanceSquared(primitiveBounds[primitive], point);
+
+				if (distance < best)
+				{
+					best			= distance;
+					nearestIndex	= primitives[primitive];
+					return true;
+				}
+
+				return false;
+			});
+		}
+
+		/** Find the primitive closest to point within distanceSquared by distanceFunc(index), narrowing it (prefer Bvh3) */
+		template<typename DistanceFunc>
+		bool QueryNearest(const Vec3f& point, float& distanceSquared, uInt32& nearestIndex, DistanceFunc distanceFunc) const
+		{
+			return NearestLeaves(point, distanceSquared, [&](uInt32 primitive, float& best)
+			{
+				const float distance = distanceFunc(primitives[primitive]);
+
+				if (distance < best)
+				{
+					best			= distance;
+					nearestIndex	= primitives[primitive];
+					return true;
+				}
+
+				return false;
+			});
+		}
+
+		/** Push the interior children in mask, farthest first so the nearest is popped next, and visit the leaves */
+		template<typename LeafFunc>
+		static bool VisitChildren(const Node& node, uInt32 mask, const float* keys, float& limit, BvhStack& stack, LeafFunc leafFunc)
+		{
+			uInt32 interior[Width];
+			uSize interiorCount = 0;
+			bool found = false;
+
+			for (; mask; mask &= mask - 1)
+			{
+				const uSize slot = CountTrailingZeros(mask);
+
+				if (node.count[slot])
+				{
+					if (keys[slot] < limit)
+					{
+						for (uInt32 i = node.offset[slot]; i < node.offset[slot] + node.count[slot]; i++)
+						{
+							found |= leafFunc(i, limit);
+						}
+					}
+
+					continue;
+				}
+
+				// Insertion sort by descending key
+				uSize i = interiorCount++;
+
+				for (; i > 0 && keys[interior[i - 1]] < keys[slot]; i--)
+				{
+					interior[i] = interior[i - 1];
+				}
+
+				interior[i] = (uInt32)slot;
+			}
+
+			for (uSize i = 0; i < interiorCount; i++)
+			{
+				stack.Push(node.offset[interior[i]], keys[interior[i]]);
+			}
+
+			return found;
+		}
+
+		/** Ray traversal calling leafFunc(primitive, tMax) for the primitives of every leaf entered */
+		template<typename LeafFunc>
+		bool RaycastLeaves(const BvhRay& ray, float& tMax, LeafFunc leafFunc) const
+		{
+			if (nodes.empty())
+			{
+				return false;
+			}
+
+			BvhStack stack((Width - 1) * depth + 1);
+			uInt32 index = 0;
+			float enter = 0.0f;
+			bool hit = false;
+			float enters[Width];
+
+			do
+			{
+				if (enter < tMax)
+				{
+					const Node& node = nodes[index];
+					hit |= VisitChildren(node, node.IntersectRay(ray, tMax, enters), enters, tMax, stack, leafFunc);
+				}
+			}
+			while (stack.Pop(index, enter));
+
+			return hit;
+		}
+
+		/** Nearest point traversal calling leafFunc(primitive, distanceSquared) for the leaves within reach */
+		template<typename LeafFunc>
+		bool NearestLeaves(const Vec3f& point, float& distanceSquared, LeafFunc leafFunc) const
+		{
+			if (nodes.empty())
+			{
+				return false;
+			}
+
+			BvhStack stack((Width - 1) * depth + 1);
+			uInt32 index = 0;
+			float distance = 0.0f;
+			bool found = false;
+			float distances[Width];
+
+			do
+			{
+				if (distance < distanceSquared)
+				{
+					const Node& node = nodes[index];
+					found |= VisitChildren(node, node.IntersectPoint(point, distanceSquared, distances), distances, distanceSquared, stack, leafFunc);
+				}
+			}
+			while (stack.Pop(index, distance));
+
+			return found;
+		}
+	};
+
+	typedef Bvh3Wide<4> Bvh3x4;
+	typedef Bvh3Wide<8> Bvh3x8;
+}
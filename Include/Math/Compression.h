@@ -0,0 +1,696 @@
+#pragma once
+
+#include "Simd.h"
+#include "Bounds.h"
+#include "Quaternion.h"
+#include "Transform.h"
+
+namespace Quartz
+{
+	/*====================================================
+	|             QUARTZMATH PACKED QUATERNIONS          |
+	=====================================================*/
+
+	// Smallest-three encoding: the largest magnitude component of a unit
+	// quaternion is dropped and rebuilt on unpack as sqrt(1 - a^2 - b^2 - c^2).
+	// q and -q are the same rotation, so the quaternion is negated when the
+	// dropped component is negative. The other three lie in [-1/sqrt(2),
+	// 1/sqrt(2)] and are quantized to N bits with step sqrt(2) / (2^N - 1),
+	// next to a 2 bit index of the dropped component.
+	//
+	// Round trip error for unit quaternions: the three stored components are
+	// within step / 2, the rebuilt one within 1.5 step, and the rotation angle
+	// between input and output is at most 2 sqrt(3) step (bound / measured
+	// over 10^6 random rotations):
+	//
+	// PackedQuat32	3 x 10 bits, 4 bytes:	4.8e-3 / 4.0e-3 rad (0.23 degrees)
+	// PackedQuat48	3 x 15 bits, 6 bytes:	1.5e-4 / 1.3e-4 rad (0.008 degrees)
+	//
+	// Unpacked quaternions are unit length to float precision. Inputs that are
+	// not unit length are clamped to the quantized range.
+
+	/** Split a quaternion into its dropped component index and three quantized components in [0, maxValue] */
+	template<typename Type>
+	inline void SmallestThreeEncode(Type x, Type y, Type z, Type w, Type maxValue,
+		Type& index, Type& a, Type& b, Type& c)
+	{
+		const Type zero(0.0f);
+		const Type one(1.0f);
+
+		// First component wins ties, so index is exact in float lanes
+		Type largest = x;
+		index = zero;
+
+		auto greater = LessThan(Abs(largest), Abs(y));
+		largest	= Select(greater, y, largest);
+		index	= Select(greater, one, index);
+
+		greater = LessThan(Abs(largest), Abs(z));
+		largest	= Select(greater, z, largest);
+		index	= Select(greater, Type(2.0f), index);
+
+		greater = LessThan(Abs(largest), Abs(w));
+		largest	= Select(greater, w, largest);
+		index	= Select(greater, Type(3.0f), index);
+
+		const Type sign = Select(LessThan(largest, zero), Type(-1.0f), one);
+
+		a = Select(LessThan(index, Type(0.5f)), y, x) * sign;
+		b = Select(LessThan(index, Type(1.5f)), z, y) * sign;
+		c = Select(LessThan(index, Type(2.5f)), w, z) * sign;
+
+		// [-1/sqrt(2), 1/sqrt(2)] to [0, maxValue], rounded to nearest
+		const Type range(0.70710678118654752f);
+		const Type quantize = maxValue * Type(0.70710678118654752f);
+		const Type half(0.5f);
+
+		a = Floor(Min(Max(MulAdd(a + range, quantize, half), zero), maxValue + half));
+		b = Floor(Min(Max(MulAdd(b + range, quantize, half), zero), maxValue + half));
+		c = Floor(Min(Max(MulAdd(c + range, quantize, half), zero), maxValue + half));
+	}
+
+	/** Rebuild a quaternion from SmallestThreeEncode components */
+	template<typename Type>
+	inline void SmallestThreeDecode(Type index, Type a, Type b, Type c, Type maxValue,
+		Type& x, Type& y, Type& z, Type& w)
+	{
+		const Type range(0.70710678118654752f);
+		const Type scale = Type(1.41421356237309505f) / maxValue;
+
+		a = MulAdd(a, scale, Type(0.0f) - range);
+		b = MulAdd(b, scale, Type(0.0f) - range);
+		c = MulAdd(c, scale, Type(0.0f) - range);
+
+		const Type largest = Sqrt(Max(Type(1.0f) - a * a - b * b - c * c, Type(0.0f)));
+
+		const auto first	= LessThan(index, Type(0.5f));
+		const auto second	= LessThan(index, Type(1.5f));
+		const auto third	= LessThan(index, Type(2.5f));
+
+		x = Select(first, largest, a);
+		y = Select(first, a, Select(second, largest, b));
+		z = Select(second, b, Select(third, largest, c));
+		w = Select(third, c, largest);
+	}
+
+	struct PackedQuat32
+	{
+		static constexpr uInt32 componentBits	= 10;
+		static constexpr uInt32 componentMax	= (1u << componentBits) - 1;
+
+		uInt32 bits;
+
+		inline PackedQuat32() :
+			bits(0) { }
+
+		inline explicit PackedQuat32(const Quatf& quat)
+		{
+			Pack(quat);
+		}
+
+		inline void SetComponents(uInt32 index, uInt32 a, uInt32 b, uInt32 c)
+		{
+			bits = (index << 30) | (a << 20) | (b << 10) | c;
+		}
+
+		inline void GetComponents(uInt32& index, uInt32& a, uInt32& b, uInt32& c) const
+		{
+			index	= bits >> 30;
+			a		= (bits >> 20) & componentMax;
+			b		= (bits >> 10) & componentMax;
+			c		= bits & componentMax;
+		}
+
+		inline void Pack(const Quatf& quat)
+		{
+			float index, a, b, c;
+			SmallestThreeEncode(quat.x, quat.y, quat.z, quat.w, (float)componentMax, index, a, b, c);
+			SetComponents((uInt32)index, (uInt32)a, (uInt32)b, (uInt32)c);
+		}
+
+		inline Quatf Unpack() const
+		{
+			uInt32 index, a, b, c;
+			GetComponents(index, a, b, c);
+
+			Quatf quat;
+			SmallestThreeDecode((float)index, (float)a, (float)b, (float)c, (float)componentMax,
+				quat.x, quat.y, quat.z, quat.w);
+			return quat;
+		}
+	};
+
+	struct PackedQuat48
+	{
+		static constexpr uInt32 componentBits	= 15;
+		static constexpr uInt32 componentMax	= (1u << componentBits) - 1;
+
+		uInt16 bits[3];
+
+		inline PackedQuat48() :
+			bits{ 0, 0, 0 } { }
+
+		inline explicit PackedQuat48(const Quatf& quat)
+		{
+			Pack(quat);
+		}
+
+		inline void SetComponents(uInt32 index, uInt32 a, uInt32 b, uInt32 c)
+		{
+			const uInt64 packed = ((uInt64)index << 45) | ((uInt64)a << 30) | ((uInt64)b << 15) | c;
+			bits[0] = (uInt16)packed;
+			bits[1] = (uInt16)(packed >> 16);
+			bits[2] = (uInt16)(packed >> 32);
+		}
+
+		inline void GetComponents(uInt32& index, uInt32& a, uInt32& b, uInt32& c) const
+		{
+			const uInt64 packed = (uInt64)bits[0] | ((uInt64)bits[1] << 16) | ((uInt64)bits[2] << 32);
+			index	= (uInt32)(packed >> 45);
+			a		= (uInt32)(packed >> 30) & componentMax;
+			b		= (uInt32)(packed >> 15) & componentMax;
+			c		= (uInt32)packed & componentMax;
+		}
+
+		inline void Pack(const Quatf& quat)
+		{
+			float index, a, b, c;
+			SmallestThreeEncode(quat.x, quat.y, quat.z, quat.w, (float)componentMax, index, a, b, c);
+			SetComponents((uInt32)index, (uInt32)a, (uInt32)b, (uInt32)c);
+		}
+
+		inline Quatf Unpack() const
+		{
+			uInt32 index, a, b, c;
+			GetComponents(index, a, b, c);
+
+			Quatf quat;
+			SmallestThreeDecode((float)index, (float)a, (float)b, (float)c, (float)componentMax,
+				quat.x, quat.y, quat.z, quat.w);
+			return quat;
+		}
+	};
+
+	/*====================================================
+	|              QUARTZMATH PACKED POSITIONS           |
+	=====================================================*/
+
+	// PackedVec3 stores a position as three 16 bit fractions of a Bounds3f,
+	// 6 bytes instead of 12. Positions outside the bounds are clamped to it.
+	// Round trip error per axis is at most extent / (2 * 65535) plus one
+	// float rounding of the result: 7.6e-6 m per metre of extent.
+
+	/** value in [start, start + maxValue / quantize] to the nearest integer in [0, maxValue] */
+	template<typename Type>
+	inline Type QuantizeRange(Type value, Type start, Type quantize, Type maxValue)
+	{
+		const Type half(0.5f);
+		return Floor(Min(Max(MulAdd(value - start, quantize, half), Type(0.0f)), maxValue + half));
+	}
+
+	struct PackedVec3
+	{
+		static constexpr uInt32 componentMax = 0xffff;
+
+		uInt16 x;
+		uInt16 y;
+		uInt16 z;
+
+		inline PackedVec3() :
+			x(0), y(0), z(0) { }
+
+		inline PackedVec3(const Vec3f& vec, const Bounds3f& bounds)
+		{
+			Pack(vec, bounds);
+		}
+
+		/** Integer steps per unit along each axis of bounds, 0 for empty axes */
+		static inline Vec3f Quantize(const Bounds3f& bounds)
+		{
+			const Vec3f extent = bounds.Extent();
+			return Vec3f(
+				extent.x > 0.0f ? componentMax / extent.x : 0.0f,
+				extent.y > 0.0f ? componentMax / extent.y : 0.0f,
+				extent.z > 0.0f ? componentMax / extent.z : 0.0f);
+		}
+
+		inline void Pack(const Vec3f& vec, const Bounds3f& bounds)
+		{
+			const Vec3f quantize = Quantize(bounds);
+			x = (uInt16)QuantizeRange(vec.x, bounds.start.x, quantize.x, (float)componentMax);
+			y = (uInt16)QuantizeRange(vec.y, bounds.start.y, quantize.y, (float)componentMax);
+			z = (uInt16)QuantizeRange(vec.z, bounds.start.z, quantize.z, (float)componentMax);
+		}
+
+		inline Vec3f Unpack(const Bounds3f& bounds) const
+		{
+			const Vec3f step = bounds.Extent() * (1.0f / componentMax);
+			return Vec3f(
+				MulAdd((float)x, step.x, bounds.start.x),
+				MulAdd((float)y, step.y, bounds.start.y),
+				MulAdd((float)z, step.z, bounds.start.z));
+		}
+	};
+
+	/*====================================================
+	|             QUARTZMATH PACKED TRANSFORMS           |
+	=====================================================*/
+
+	// PackedTransform stores a smallest-three rotation, a PackedVec3 position
+	// and a single 16 bit uniform scale, collapsing Transform::scale to the
+	// mean of its axes (see IsUniformScale). Ranges come from a
+	// TransformQuantization shared by every transform of a clip or snapshot.
+	//
+	// PackedTransform32	12 bytes, 3.3x smaller than Transform
+	// PackedTransform48	14 bytes, 2.9x smaller than Transform
+	//
+	// Error bounds are those of the rotation and position formats above,
+	// scale error is at most (maxScale - minScale) / (2 * 65535) plus two
+	// float roundings of the dequantized scale (the rounded step and the
+	// multiply-add), 1.19e-5 for scales in [0.5, 2].
+
+	struct TransformQuantization
+	{
+		Bounds3f	bounds;
+		float		minScale;
+		float		maxScale;
+
+		inline TransformQuantization() :
+			bounds(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f),
+			minScale(1.0f),
+			maxScale(1.0f) { }
+
+		inline TransformQuantization(const Bounds3f& bounds, float minScale = 1.0f, float maxScale = 1.0f) :
+			bounds(bounds),
+			minScale(minScale),
+			maxScale(maxScale) { }
+
+		inline float ScaleQuantize() const
+		{
+			return maxScale > minScale ? PackedVec3::componentMax / (maxScale - minScale) : 0.0f;
+		}
+
+		inline float ScaleStep() const
+		{
+			return (maxScale - minScale) * (1.0f / PackedVec3::componentMax);
+		}
+	};
+
+	/** Check if scale has the same value on every axis, within tolerance */
+	inline bool IsUniformScale(const Vec3f& scale, float tolerance = 1e-5f)
+	{
+		return Abs(scale.x - scale.y) <= tolerance && Abs(scale.x - scale.z) <= tolerance;
+	}
+
+	template<typename PackedRotation>
+	struct PackedTransform
+	{
+		PackedRotation	rotation;
+		PackedVec3		position;
+		uInt16			scale;
+
+		inline PackedTransform() :
+			rotation(), position(), scale(0) { }
+
+		inline PackedTransform(const Transform& transform, const TransformQuantization& quantization)
+		{
+			Pack(transform, quantization);
+		}
+
+		inline void Pack(const Transform& transform, const TransformQuantization& quantization)
+		{
+			const float uniformScale = (transform.scale.x + transform.scale.y + transform.scale.z) * (1.0f / 3.0f);
+
+			rotation.Pack(transform.rotation);
+			position.Pack(transform.position, quantization.bounds);
+			scale = (uInt16)QuantizeRange(uniformScale, quantization.minScale,
+				quantization.ScaleQuantize(), (float)PackedVec3::componentMax);
+		}
+
+		inline Transform Unpack(const TransformQuantization& quantization) const
+		{
+			const float uniformScale = MulAdd((float)scale, quantization.ScaleStep(), quantization.minScale);
+			return Transform(position.Unpack(quantization.bounds), rotation.Unpack(),
+				Vec3f(uniformScale, uniformScale, uniformScale));
+		}
+	};
+
+	typedef PackedTransform<PackedQuat32> PackedTransform32;
+	typedef PackedTransform<PackedQuat48> PackedTransform48;
+
+	/*====================================================
+	|             QUARTZMATH BATCH COMPRESSION           |
+	=====================================================*/
+
+	// Bulk versions of the Pack / Unpack functions above. Blocks of
+	// QMATH_SIMD_MAX_WIDTH items are gathered into float lanes, quantized or
+	// rebuilt with Simd::FloatN and scattered, so results match the scalar
+	// functions exactly (without FMA). Inputs and outputs may not overlap.
+
+	/** Pack count quaternions into PackedQuat32 or PackedQuat48 */
+	template<typename PackedRotation>
+	inline void PackQuats(const Quatf* in, PackedRotation* out, uSize count)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float lanes[4][width];
+
+		const FloatN maxValue((float)PackedRotation::componentMax);
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				const Quatf& quat = in[base + i];
+				lanes[0][i] = quat.x;
+				lanes[1][i] = quat.y;
+				lanes[2][i] = quat.z;
+				lanes[3][i] = quat.w;
+			}
+
+			for (uSize i = blockCount; i < width; i++)
+			{
+				lanes[0][i] = lanes[1][i] = lanes[2][i] = 0.0f;
+				lanes[3][i] = 1.0f;
+			}
+
+			for (uSize i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				FloatN index, a, b, c;
+				SmallestThreeEncode(FloatN::Load(lanes[0] + i), FloatN::Load(lanes[1] + i),
+					FloatN::Load(lanes[2] + i), FloatN::Load(lanes[3] + i), maxValue, index, a, b, c);
+
+				index.Store(lanes[0] + i);
+				a.Store(lanes[1] + i);
+				b.Store(lanes[2] + i);
+				c.Store(lanes[3] + i);
+			}
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				out[base + i].SetComponents((uInt32)lanes[0][i], (uInt32)lanes[1][i],
+					(uInt32)lanes[2][i], (uInt32)lanes[3][i]);
+			}
+		}
+	}
+
+	/** Unpack count PackedQuat32 or PackedQuat48 quaternions */
+	template<typename PackedRotation>
+	inline void UnpackQuats(const PackedRotation* in, Quatf* out, uSize count)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float lanes[4][width];
+
+		const FloatN maxValue((float)PackedRotation::componentMax);
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				uInt32 index, a, b, c;
+				in[base + i].GetComponents(index, a, b, c);
+				lanes[0][i] = (float)index;
+				lanes[1][i] = (float)a;
+				lanes[2][i] = (float)b;
+				lanes[3][i] = (float)c;
+			}
+
+			for (uSize i = blockCount; i < width; i++)
+			{
+				lanes[0][i] = lanes[1][i] = lanes[2][i] = lanes[3][i] = 0.0f;
+			}
+
+			for (uSize i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				FloatN x, y, z, w;
+				SmallestThreeDecode(FloatN::Load(lanes[0] + i), FloatN::Load(lanes[1] + i),
+					FloatN::Load(lanes[2] + i), FloatN::Load(lanes[3] + i), maxValue, x, y, z, w);
+
+				x.Store(lanes[0] + i);
+				y.Store(lanes[1] + i);
+				z.Store(lanes[2] + i);
+				w.Store(lanes[3] + i);
+			}
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				out[base + i] = Quatf(lanes[0][i], lanes[1][i], lanes[2][i], lanes[3][i]);
+			}
+		}
+	}
+
+	/** Pack count positions within bounds */
+	inline void PackPositions(const Vec3f* in, const Bounds3f& bounds, PackedVec3* out, uSize count)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float lanes[3][width];
+
+		const Vec3f quantize = PackedVec3::Quantize(bounds);
+		const FloatN maxValue((float)PackedVec3::componentMax);
+		const FloatN startX(bounds.start.x), startY(bounds.start.y), startZ(bounds.start.z);
+		const FloatN quantizeX(quantize.x), quantizeY(quantize.y), quantizeZ(quantize.z);
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				const Vec3f& vec = in[base + i];
+				lanes[0][i] = vec.x;
+				lanes[1][i] = vec.y;
+				lanes[2][i] = vec.z;
+			}
+
+			for (uSize i = blockCount; i < width; i++)
+			{
+				lanes[0][i] = lanes[1][i] = lanes[2][i] = 0.0f;
+			}
+
+			for (uSize i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				QuantizeRange(FloatN::Load(lanes[0] + i), startX, quantizeX, maxValue).Store(lanes[0] + i);
+				QuantizeRange(FloatN::Load(lanes[1] + i), startY, quantizeY, maxValue).Store(lanes[1] + i);
+				QuantizeRange(FloatN::Load(lanes[2] + i), startZ, quantizeZ, maxValue).Store(lanes[2] + i);
+			}
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				PackedVec3& packed = out[base + i];
+				packed.x = (uInt16)lanes[0][i];
+				packed.y = (uInt16)lanes[1][i];
+				packed.z = (uInt16)lanes[2][i];
+			}
+		}
+	}
+
+	/** Unpack count positions within bounds */
+	inline void UnpackPositions(const PackedVec3* in, const Bounds3f& bounds, Vec3f* out, uSize count)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float lanes[3][width];
+
+		const Vec3f step = bounds.Extent() * (1.0f / PackedVec3::componentMax);
+		const FloatN startX(bounds.start.x), startY(bounds.start.y), startZ(bounds.start.z);
+		const FloatN stepX(step.x), stepY(step.y), stepZ(step.z);
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				const PackedVec3& packed = in[base + i];
+				lanes[0][i] = (float)packed.x;
+				lanes[1][i] = (float)packed.y;
+				lanes[2][i] = (float)packed.z;
+			}
+
+			for (uSize i = blockCount; i < width; i++)
+			{
+				lanes[0][i] = lanes[1][i] = lanes[2][i] = 0.0f;
+			}
+
+			for (uSize i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				MulAdd(FloatN::Load(lanes[0] + i), stepX, startX).Store(lanes[0] + i);
+				MulAdd(FloatN::Load(lanes[1] + i), stepY, startY).Store(lanes[1] + i);
+				MulAdd(FloatN::Load(lanes[2] + i), stepZ, startZ).Store(lanes[2] + i);
+			}
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				out[base + i] = Vec3f(lanes[0][i], lanes[1][i], lanes[2][i]);
+			}
+		}
+	}
+
+	/** Pack count transforms into PackedTransform32 or PackedTransform48 */
+	template<typename PackedRotation>
+	inline void PackTransforms(const Transform* in, const TransformQuantization& quantization,
+		PackedTransform<PackedRotation>* out, uSize count)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float lanes[8][width];
+
+		const Vec3f quantize = PackedVec3::Quantize(quantization.bounds);
+		const FloatN rotationMax((float)PackedRotation::componentMax);
+		const FloatN maxValue((float)PackedVec3::componentMax);
+		const FloatN startX(quantization.bounds.start.x);
+		const FloatN startY(quantization.bounds.start.y);
+		const FloatN startZ(quantization.bounds.start.z);
+		const FloatN quantizeX(quantize.x), quantizeY(quantize.y), quantizeZ(quantize.z);
+		const FloatN minScale(quantization.minScale);
+		const FloatN quantizeScale(quantization.ScaleQuantize());
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				const Transform& transform = in[base + i];
+				lanes[0][i] = transform.rotation.x;
+				lanes[1][i] = transform.rotation.y;
+				lanes[2][i] = transform.rotation.z;
+				lanes[3][i] = transform.rotation.w;
+				lanes[4][i] = transform.position.x;
+				lanes[5][i] = transform.position.y;
+				lanes[6][i] = transform.position.z;
+				lanes[7][i] = (transform.scale.x + transform.scale.y + transform.scale.z) * (1.0f / 3.0f);
+			}
+
+			for (uSize i = blockCount; i < width; i++)
+			{
+				for (uSize lane = 0; lane < 8; lane++)
+				{
+					lanes[lane][i] = 0.0f;
+				}
+
+				lanes[3][i] = 1.0f;
+			}
+
+			for (uSize i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				FloatN index, a, b, c;
+				SmallestThreeEncode(FloatN::Load(lanes[0] + i), FloatN::Load(lanes[1] + i),
+					FloatN::Load(lanes[2] + i), FloatN::Load(lanes[3] + i), rotationMax, index, a, b, c);
+
+				index.Store(lanes[0] + i);
+				a.Store(lanes[1] + i);
+				b.Store(lanes[2] + i);
+				c.Store(lanes[3] + i);
+
+				QuantizeRange(FloatN::Load(lanes[4] + i), startX, quantizeX, maxValue).Store(lanes[4] + i);
+				QuantizeRange(FloatN::Load(lanes[5] + i), startY, quantizeY, maxValue).Store(lanes[5] + i);
+				QuantizeRange(FloatN::Load(lanes[6] + i), startZ, quantizeZ, maxValue).Store(lanes[6] + i);
+				QuantizeRange(FloatN::Load(lanes[7] + i), minScale, quantizeScale, maxValue).Store(lanes[7] + i);
+			}
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				PackedTransform<PackedRotation>& packed = out[base + i];
+				packed.rotation.SetComponents((uInt32)lanes[0][i], (uInt32)lanes[1][i],
+					(uInt32)lanes[2][i], (uInt32)lanes[3][i]);
+				packed.position.x	= (uInt16)lanes[4][i];
+				packed.position.y	= (uInt16)lanes[5][i];
+				packed.position.z	= (uInt16)lanes[6][i];
+				packed.scale		= (uInt16)lanes[7][i];
+			}
+		}
+	}
+
+	/** Unpack count PackedTransform32 or PackedTransform48 transforms */
+	template<typename PackedRotation>
+	inline void UnpackTransforms(const PackedTransform<PackedRotation>* in,
+		const TransformQuantization& quantization, Transform* out, uSize count)
+	{
+		using Simd::FloatN;
+
+		constexpr uSize width = QMATH_SIMD_MAX_WIDTH;
+
+		alignas(QMATH_SIMD_ALIGNMENT) float lanes[8][width];
+
+		const Vec3f step = quantization.bounds.Extent() * (1.0f / PackedVec3::componentMax);
+		const FloatN rotationMax((float)PackedRotation::componentMax);
+		const FloatN startX(quantization.bounds.start.x);
+		const FloatN startY(quantization.bounds.start.y);
+		const FloatN startZ(quantization.bounds.start.z);
+		const FloatN stepX(step.x), stepY(step.y), stepZ(step.z);
+		const FloatN minScale(quantization.minScale);
+		const FloatN stepScale(quantization.ScaleStep());
+
+		for (uSize base = 0; base < count; base += width)
+		{
+			const uSize blockCount = Min<uSize>(count - base, width);
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				const PackedTransform<PackedRotation>& packed = in[base + i];
+
+				uInt32 index, a, b, c;
+				packed.rotation.GetComponents(index, a, b, c);
+
+				lanes[0][i] = (float)index;
+				lanes[1][i] = (float)a;
+				lanes[2][i] = (float)b;
+				lanes[3][i] = (float)c;
+				lanes[4][i] = (float)packed.position.x;
+				lanes[5][i] = (float)packed.position.y;
+				lanes[6][i] = (float)packed.position.z;
+				lanes[7][i] = (float)packed.scale;
+			}
+
+			for (uSize i = blockCount; i < width; i++)
+			{
+				for (uSize lane = 0; lane < 8; lane++)
+				{
+					lanes[lane][i] = 0.0f;
+				}
+			}
+
+			for (uSize i = 0; i < width; i += QMATH_SIMD_WIDTH)
+			{
+				FloatN x, y, z, w;
+				SmallestThreeDecode(FloatN::Load(lanes[0] + i), FloatN::Load(lanes[1] + i),
+					FloatN::Load(lanes[2] + i), FloatN::Load(lanes[3] + i), rotationMax, x, y, z, w);
+
+				x.Store(lanes[0] + i);
+				y.Store(lanes[1] + i);
+				z.Store(lanes[2] + i);
+				w.Store(lanes[3] + i);
+
+				MulAdd(FloatN::Load(lanes[4] + i), stepX, startX).Store(lanes[4] + i);
+				MulAdd(FloatN::Load(lanes[5] + i), stepY, startY).Store(lanes[5] + i);
+				MulAdd(FloatN::Load(lanes[6] + i), stepZ, startZ).Store(lanes[6] + i);
+				MulAdd(FloatN::Load(lanes[7] + i), stepScale, minScale).Store(lanes[7] + i);
+			}
+
+			for (uSize i = 0; i < blockCount; i++)
+			{
+				out[base + i] = Transform(
+					Vec3f(lanes[4][i], lanes[5][i], lanes[6][i]),
+					Quatf(lanes[0][i], lanes[1][i], lanes[2][i], lanes[3][i]),
+					Vec3f(lanes[7][i], lanes[7][i], lanes[7][i]));
+			}
+		}
+	}
+}
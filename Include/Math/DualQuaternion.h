@@ -0,0 +1,192 @@
+#pragma once
+
+#include "Vector.h"
+#include "Quaternion.h"
+#include "Matrix.h"
+#include "Transform.h"
+
+namespace Quartz
+{
+	/*====================================================
+	|             QUARTZMATH DUAL QUATERNION             |
+	=====================================================*/
+
+	// A unit DualQuaternion real + dual * e (e^2 = 0) is a rigid transform:
+	// real is the rotation and dual = 0.5 * (translation, 0) * real. Points
+	// rotate like Matrix4::SetRotation(real) (real * p * real^-1), which is
+	// not the direction of Quaternion::operator*(Vector3).
+	//
+	// operator* is the dual quaternion product, so a * b applies b first and
+	// then a: (a * b).ToMatrix4() == b.ToMatrix4() * a.ToMatrix4(). Inverse
+	// and the transform functions assume a unit dual quaternion; blends of
+	// several (skinning) must be normalized first.
+
+	template<typename IntType>
+	struct DualQuaternion
+	{
+		Quaternion<IntType> real;
+		Quaternion<IntType> dual;
+
+		/** Construct an identity DualQuaternion */
+		constexpr DualQuaternion()
+			: real(0, 0, 0, 1), dual(0, 0, 0, 0) {}
+
+		/** Construct a DualQuaternion from its real and dual parts */
+		constexpr DualQuaternion(const Quaternion<IntType>& real, const Quaternion<IntType>& dual)
+			: real(real), dual(dual) {}
+
+		/** Construct a DualQuaternion that rotates, then translates */
+		constexpr DualQuaternion(const Quaternion<IntType>& rotation, const Vector3<IntType>& translation)
+		{
+			SetRotationTranslation(rotation, translation);
+		}
+
+		/** Construct a DualQuaternion from another DualQuaternion */
+		template<typename OIntType>
+		constexpr DualQuaternion(const DualQuaternion<OIntType>& dualQuat)
+			: real(dualQuat.real), dual(dualQuat.dual) {}
+
+		/** Construct a DualQuaternion from the rotation and translation of a Transform, scale is ignored */
+		explicit constexpr DualQuaternion(const Transform& transform)
+		{
+			SetRotationTranslation(Quaternion<IntType>(transform.rotation), Vector3<IntType>(transform.position));
+		}
+
+		/** Construct a DualQuaternion from the rotation and translation of an affine matrix, scale is ignored */
+		explicit constexpr DualQuaternion(const Matrix4<IntType>& mat4)
+		{
+			Vector3<IntType> translation, scale;
+			Quaternion<IntType> rotation;
+			mat4.DecomposeTRS(translation, rotation, scale);
+			SetRotationTranslation(rotation, translation);
+		}
+
+		/** Set to rotation, then translation */
+		constexpr DualQuaternion& SetRotationTranslation(const Quaternion<IntType>& rotation, const Vector3<IntType>& translation)
+		{
+			real = rotation;
+			dual = Quaternion<IntType>(translation.x, translation.y, translation.z, 0) * rotation * IntType(0.5f);
+			return *this;
+		}
+
+		/** Get the rotation */
+		constexpr Quaternion<IntType> GetRotation() const
+		{
+			return real;
+		}
+
+		/** Get the translation, 2 * dual * real^-1 */
+		constexpr Vector3<IntType> GetTranslation() const
+		{
+			const Vector3<IntType> realVec(real.x, real.y, real.z);
+			const Vector3<IntType> dualVec(dual.x, dual.y, dual.z);
+			return IntType(2) * (real.w * dualVec - dual.w * realVec + Cross(realVec, dualVec));
+		}
+
+		/** Get the equivalent Matrix4 */
+		constexpr Matrix4<IntType> ToMatrix4() const
+		{
+			return Matrix4<IntType>().SetTRS(GetTranslation(), real, Vector3<IntType>(1, 1, 1));
+		}
+
+		/** Get the equivalent Transform, with a scale of one */
+		constexpr Transform ToTransform() const
+		{
+			return Transform(Vec3f(GetTranslation()), Quatf(real), Vec3f(1.0f, 1.0f, 1.0f));
+		}
+
+		/** Normalize this dual quaternion: unit real part and dual orthogonal to it */
+		template<Precision precision = Precision::Fast>
+		DualQuaternion& Normalize()
+		{
+			const IntType inverse = real.template InverseMagnitude<precision>();
+			real = real * inverse;
+			dual = dual * inverse;
+			dual = dual - real * Dot(real, dual);
+			return *this;
+		}
+
+		/** Get the normalized dual quaternion */
+		template<Precision precision = Precision::Fast>
+		DualQuaternion Normalized() const
+		{
+			return DualQuaternion(*this).template Normalize<precision>();
+		}
+
+		/** Get the conjugate of both parts */
+		constexpr DualQuaternion Conjugate() const
+		{
+			return DualQuaternion(real.Conjugate(), dual.Conjugate());
+		}
+
+		/** Get the inverse of a unit dual quaternion */
+		constexpr DualQuaternion Inverse() const
+		{
+			return Conjugate();
+		}
+
+		/** Transform a point: rotate, then translate */
+		constexpr Vector3<IntType> TransformPoint(const Vector3<IntType>& point) const
+		{
+			return TransformDirection(point) + GetTranslation();
+		}
+
+		/** Transform a direction: rotate only */
+		constexpr Vector3<IntType> TransformDirection(const Vector3<IntType>& direction) const
+		{
+			const Vector3<IntType> realVec(real.x, real.y, real.z);
+			return direction + IntType(2) * Cross(realVec, Cross(realVec, direction) + real.w * direction);
+		}
+
+		/** Multiply a dual quaternion to this, the result applies dualQuat first */
+		constexpr DualQuaternion operator*(const DualQuaternion& dualQuat) const
+		{
+			return DualQuaternion(real * dualQuat.real, real * dualQuat.dual + dual * dualQuat.real);
+		}
+
+		/** Multiply a dual quaternion to this */
+		constexpr void operator*=(const DualQuaternion& dualQuat)
+		{
+			*this = *this * dualQuat;
+		}
+
+		/** Multiply a IntType to this */
+		constexpr DualQuaternion operator*(IntType value) const
+		{
+			return DualQuaternion(real * value, dual * value);
+		}
+
+		/** Multiply a IntType to this */
+		friend constexpr DualQuaternion operator*(IntType value, const DualQuaternion& dualQuat)
+		{
+			return dualQuat * value;
+		}
+
+		/** Add a dual quaternion to this */
+		constexpr DualQuaternion operator+(const DualQuaternion& dualQuat) const
+		{
+			return DualQuaternion(real + dualQuat.real, dual + dualQuat.dual);
+		}
+
+		/** Add a dual quaternion to this */
+		constexpr void operator+=(const DualQuaternion& dualQuat)
+		{
+			*this = *this + dualQuat;
+		}
+
+		/** Check if two dual quaternions are equal */
+		constexpr bool operator==(const DualQuaternion& dualQuat) const
+		{
+			return real == dualQuat.real && dual == dualQuat.dual;
+		}
+
+		/** Check if two dual quaternions are not equal */
+		constexpr bool operator!=(const DualQuaternion& dualQuat) const
+		{
+			return !(*this == dualQuat);
+		}
+	};
+
+	typedef DualQuaternion<float>	DualQuatf;
+	typedef DualQuaternion<double>	DualQuatd;
+}
@@ -0,0 +1,274 @@
+#pragma once
+
+#include "Simd.h"
+#include "Util.h"
+#include <math.h>
+
+// Route the library's own trig (Quaternion::SetAxisAngle, Quaternion::SetEuler,
+// Matrix4::SetPerspective and NoiseGradient::Angle gradients) through FastTrig
+#ifndef QMATH_USE_FAST_TRIG
+#define QMATH_USE_FAST_TRIG 0
+#endif
+
+namespace Quartz
+{
+	/*====================================================
+	|                 QUARTZMATH FAST TRIG               |
+	=====================================================*/
+
+	// Polynomial approximations (cephes minimax coefficients) that run on
+	// float or on QMATH_SIMD_WIDTH lanes of Simd::FloatN without calling libm.
+	// Each kernel is written once as a template and the float and FloatN
+	// overloads below forward to it. Maximum errors, measured against double
+	// precision libm over the stated range:
+	//
+	// Sin, Cos	|x| <= 8192: 1e-7 absolute. Reduction is three-part Cody-Waite
+	//			in float, so accuracy degrades beyond that
+	// Tan		|x| <= pi: 3.5 ULP where |sin x| and |cos x| > 0.01. Larger x
+	//			carry the absolute error of Sin / Cos
+	// Atan2	3.5 ULP (2.7e-7 radians), Atan2(0, 0) = 0
+	// Exp2		1.5 ULP, x is clamped to [-126, 127]
+	// Log2		1 ULP where |log2 x| >= 0.5, 6e-8 absolute below. x must be
+	//			positive and normal
+	//
+	// Lanes are independent, so the float and FloatN forms return the same
+	// results for the same inputs.
+
+	/** Sine and cosine of |r| <= pi/4 */
+	template<typename Type>
+	inline void SinCosReduced(Type r, Type& sin, Type& cos)
+	{
+		const Type z = r * r;
+
+		Type sinPoly = MulAdd(Type(-1.9515295891e-4f), z, Type(8.3321608736e-3f));
+		sinPoly = MulAdd(sinPoly, z, Type(-1.6666654611e-1f));
+		sin = MulAdd(sinPoly * z, r, r);
+
+		Type cosPoly = MulAdd(Type(2.443315711809948e-5f), z, Type(-1.388731625493765e-3f));
+		cosPoly = MulAdd(cosPoly, z, Type(4.166664568298827e-2f));
+		cos = MulAdd(cosPoly * z, z, MulAdd(Type(-0.5f), z, Type(1.0f)));
+	}
+
+	template<typename Type>
+	inline void SinCosKernel(Type x, Type& sin, Type& cos)
+	{
+		const Type one(1.0f);
+		const Type two(2.0f);
+
+		// x = k * pi/2 + r, pi/2 split so k * piA and k * piB are exact
+		const Type k = Floor(MulAdd(x, Type(0.63661977236758134f), Type(0.5f)));
+		Type r = MulAdd(k, Type(-1.5703125f), x);
+		r = MulAdd(k, Type(-4.837512969970703125e-4f), r);
+		r = MulAdd(k, Type(-7.54978995489188216e-8f), r);
+
+		Type sinR, cosR;
+		SinCosReduced(r, sinR, cosR);
+
+		// Quadrant k mod 4 split into exact 0 / 1 values: odd swaps sin and
+		// cos, second negates sin and odd ^ second negates cos
+		const Type quarter	= k * Type(0.25f);
+		const Type quadrant	= (quarter - Floor(quarter)) * Type(4.0f);
+		const Type second	= Select(LessThan(Type(1.5f), quadrant), one, Type(0.0f));
+		const Type odd		= quadrant - two * second;
+		const Type flip		= odd + second - two * odd * second;
+
+		sin = (odd * cosR + (one - odd) * sinR) * (one - two * second);
+		cos = (odd * sinR + (one - odd) * cosR) * (one - two * flip);
+	}
+
+	template<typename Type>
+	inline Type Atan2Kernel(Type y, Type x)
+	{
+		const Type zero(0.0f);
+		const Type absX = Abs(x);
+		const Type absY = Abs(y);
+
+		// atan(a) for a = min / max in [0, 1], a > tan(pi/8) is reduced with
+		// atan(a) = pi/4 + atan((a - 1) / (a + 1))
+		Type a = Min(absX, absY) / Max(Max(absX, absY), Type(1.17549435e-38f));
+
+		const auto reduce = LessThan(Type(0.41421356237f), a);
+		a = Select(reduce, (a - Type(1.0f)) / (a + Type(1.0f)), a);
+
+		const Type z = a * a;
+		Type poly = MulAdd(Type(8.05374449538e-2f), z, Type(-1.38776856032e-1f));
+		poly = MulAdd(poly, z, Type(1.99777106478e-1f));
+		poly = MulAdd(poly, z, Type(-3.33329491539e-1f));
+
+		Type result = MulAdd(poly * z, a, a) + Select(reduce, Type(0.78539816340f), zero);
+
+		result = Select(LessThan(absX, absY), Type(1.57079632679f) - result, result);
+		result = Select(LessThan(x, zero), Type(3.14159265359f) - result, result);
+		return Select(LessThan(y, zero), zero - result, result);
+	}
+
+	template<typename Type>
+	inline Type Exp2Kernel(Type x)
+	{
+		x = Min(Max(x, Type(-126.0f)), Type(127.0f));
+
+		// x = n + f with f in [-0.5, 0.5]
+		const Type n = Floor(x + Type(0.5f));
+		const Type f = x - n;
+
+		Type poly = MulAdd(Type(1.535336188319500e-4f), f, Type(1.339887440266574e-3f));
+		poly = MulAdd(poly, f, Type(9.618437357674640e-3f));
+		poly = MulAdd(poly, f, Type(5.550332471162809e-2f));
+		poly = MulAdd(poly, f, Type(2.402264791363012e-1f));
+		poly = MulAdd(poly, f, Type(6.931472028550421e-1f));
+
+		return MulAdd(poly, f, Type(1.0f)) * Exp2Integer(n);
+	}
+
+	template<typename Type>
+	inline Type Log2Kernel(Type x)
+	{
+		// x = m * 2^e with m in [sqrt(2) / 2, sqrt(2)), log2(x) = e + log2(1 + t)
+		Type e;
+		Type m = SplitExponent(x, e);
+
+		const auto high = LessThan(Type(1.41421356237f), m);
+		m = Select(high, m * Type(0.5f), m);
+		e = Select(high, e + Type(1.0f), e);
+
+		const Type t = m - Type(1.0f);
+		const Type z = t * t;
+
+		Type poly = MulAdd(Type(7.0376836292e-2f), t, Type(-1.1514610310e-1f));
+		poly = MulAdd(poly, t, Type(1.1676998740e-1f));
+		poly = MulAdd(poly, t, Type(-1.2420140846e-1f));
+		poly = MulAdd(poly, t, Type(1.4249322787e-1f));
+		poly = MulAdd(poly, t, Type(-1.6668057665e-1f));
+		poly = MulAdd(poly, t, Type(2.0000714765e-1f));
+		poly = MulAdd(poly, t, Type(-2.4999993993e-1f));
+		poly = MulAdd(poly, t, Type(3.3333331174e-1f));
+
+		// ln(1 + t) = t + y, scaled by log2(e) = 1 + 0.4426950408889634
+		const Type y = MulAdd(poly * z, t, Type(-0.5f) * z);
+		const Type log2eMinusOne(0.44269504088896340f);
+
+		return MulAdd(t, log2eMinusOne, MulAdd(y, log2eMinusOne, y)) + t + e;
+	}
+
+	/** Sine and cosine of x */
+	inline void SinCos(float x, float& sin, float& cos)
+	{
+		SinCosKernel(x, sin, cos);
+	}
+
+	/** Sine and cosine of x */
+	inline void SinCos(Simd::FloatN x, Simd::FloatN& sin, Simd::FloatN& cos)
+	{
+		SinCosKernel(x, sin, cos);
+	}
+
+	inline float Sin(float x)
+	{
+		float sin, cos;
+		SinCosKernel(x, sin, cos);
+		return sin;
+	}
+
+	inline Simd::FloatN Sin(Simd::FloatN x)
+	{
+		Simd::FloatN sin, cos;
+		SinCosKernel(x, sin, cos);
+		return sin;
+	}
+
+	inline float Cos(float x)
+	{
+		float sin, cos;
+		SinCosKernel(x, sin, cos);
+		return cos;
+	}
+
+	inline Simd::FloatN Cos(Simd::FloatN x)
+	{
+		Simd::FloatN sin, cos;
+		SinCosKernel(x, sin, cos);
+		return cos;
+	}
+
+	inline float Tan(float x)
+	{
+		float sin, cos;
+		SinCosKernel(x, sin, cos);
+		return sin / cos;
+	}
+
+	inline Simd::FloatN Tan(Simd::FloatN x)
+	{
+		Simd::FloatN sin, cos;
+		SinCosKernel(x, sin, cos);
+		return sin / cos;
+	}
+
+	/** Angle of (x, y) in [-pi, pi] */
+	inline float Atan2(float y, float x)
+	{
+		return Atan2Kernel(y, x);
+	}
+
+	/** Angle of (x, y) in [-pi, pi] */
+	inline Simd::FloatN Atan2(Simd::FloatN y, Simd::FloatN x)
+	{
+		return Atan2Kernel(y, x);
+	}
+
+	inline float Exp2(float x)
+	{
+		return Exp2Kernel(x);
+	}
+
+	inline Simd::FloatN Exp2(Simd::FloatN x)
+	{
+		return Exp2Kernel(x);
+	}
+
+	inline float Log2(float x)
+	{
+		return Log2Kernel(x);
+	}
+
+	inline Simd::FloatN Log2(Simd::FloatN x)
+	{
+		return Log2Kernel(x);
+	}
+
+	/** sinf / cosf, or SinCos when QMATH_USE_FAST_TRIG is enabled */
+	inline void TrigSinCos(float x, float& sin, float& cos)
+	{
+	#if QMATH_USE_FAST_TRIG
+		SinCosKernel(x, sin, cos);
+	#else
+		sin = sinf(x);
+		cos = cosf(x);
+	#endif
+	}
+
+	/** tanf, or Tan when QMATH_USE_FAST_TRIG is enabled */
+	inline float TrigTan(float x)
+	{
+	#if QMATH_USE_FAST_TRIG
+		return Tan(x);
+	#else
+		return tanf(x);
+	#endif
+	}
+
+	/** sin / cos for non-float types (double, Fixed has its own overload) */
+	template<typename IntType>
+	inline void TrigSinCos(IntType x, IntType& sin, IntType& cos)
+	{
+		sin = (IntType)::sin((double)x);
+		cos = (IntType)::cos((double)x);
+	}
+
+	/** tan for non-float types (double, Fixed has its own overload) */
+	template<typename IntType>
+	inline IntType TrigTan(IntType x)
+	{
+		return (IntType)::tan((double)x);
+	}
+}
@@ -0,0 +1,462 @@
+#pragma once
+
+#include "Types.h"
+#include "Util.h"
+#include "FastTrig.h"
+
+#include <type_traits>
+
+namespace Quartz
+{
+	/*====================================================
+	|                  QUARTZMATH FIXED                  |
+	=====================================================*/
+
+	// Fixed<StorageType, fractionBits> is a signed two's complement fixed
+	// point scalar for deterministic (lockstep) simulation: every operation
+	// is integer arithmetic with fully defined rounding, so results are bit
+	// identical on every compiler and machine. Fixed32 is Q16.16 (range
+	// +-32768, resolution 1.5e-5), Fixed64 is Q32.32 (range +-2.1e9,
+	// resolution 2.3e-10).
+	//
+	// Multiplication rounds to nearest (ties up), division truncates toward
+	// zero and division by zero is undefined, as for integers. Addition,
+	// subtraction and overflowing products wrap.
+	//
+	// Fixed converts implicitly from int, float and double so the library's
+	// generic code (and literals such as 2.0f) work unchanged. Converting a
+	// literal is exact and deterministic, converting computed floats is only
+	// as deterministic as the float math that produced them. Conversion back
+	// to float / double / int is explicit.
+	//
+	// Vector2/3/4, Quaternion and Matrix3/4 of Fixed work through the
+	// overloads below: SquareRoot and InverseSqrt (and so Magnitude, Normalize
+	// and Normalized at every Precision) are exact integer square roots, and
+	// SetAxisAngle, SetEuler and SetPerspective use the table based sine
+	// (TrigSinCos / TrigTan). Slerp, Log and Exp of Quaternion call libm and
+	// are not available, Nlerp and SlerpFast are.
+
+	/** 128 bit product of two 64 bit values */
+	inline void MultiplyWide(uInt64 a, uInt64 b, uInt64& high, uInt64& low)
+	{
+	#if defined(__SIZEOF_INT128__)
+		const unsigned __int128 product = (unsigned __int128)a * b;
+		high	= (uInt64)(product >> 64);
+		low		= (uInt64)product;
+	#else
+		const uInt64 aLow = a & 0xffffffffu, aHigh = a >> 32;
+		const uInt64 bLow = b & 0xffffffffu, bHigh = b >> 32;
+
+		const uInt64 lowLow		= aLow * bLow;
+		const uInt64 highLow	= aHigh * bLow;
+		const uInt64 lowHigh	= aLow * bHigh;
+		const uInt64 middle		= (lowLow >> 32) + (highLow & 0xffffffffu) + (lowHigh & 0xffffffffu);
+
+		high	= aHigh * bHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+		low		= (middle << 32) | (lowLow & 0xffffffffu);
+	#endif
+	}
+
+	/** round(a * b / 2^shift) for 0 < shift < 64, wrapped to 64 bits */
+	inline int64 MultiplyShift(int64 a, int64 b, uInt32 shift)
+	{
+		uInt64 high, low;
+		MultiplyWide((uInt64)a, (uInt64)b, high, low);
+
+		// Signed correction of the unsigned high half
+		high -= (a < 0 ? (uInt64)b : 0) + (b < 0 ? (uInt64)a : 0);
+
+		const uInt64 rounded = low + ((uInt64)1 << (shift - 1));
+		high += rounded < low;
+
+		return (int64)((rounded >> shift) | (high << (64 - shift)));
+	}
+
+	/** a * 2^shift / b truncated toward zero, for 0 < shift < 64 */
+	inline int64 DivideShift(int64 a, int64 b, uInt32 shift)
+	{
+	#if defined(__SIZEOF_INT128__)
+		return (int64)(((__int128)a * ((__int128)1 << shift)) / b);
+	#else
+		const bool negative		= (a < 0) != (b < 0);
+		const uInt64 numerator	= a < 0 ? 0 - (uInt64)a : (uInt64)a;
+		const uInt64 divisor	= b < 0 ? 0 - (uInt64)b : (uInt64)b;
+
+		// Restoring division of the 128 bit numerator * 2^shift
+		uInt64 high		= numerator >> (64 - shift);
+		uInt64 low		= numerator << shift;
+		uInt64 rest		= 0;
+		uInt64 quotient	= 0;
+
+		for (int bit = 127; bit >= 0; bit--)
+		{
+			const bool carry = (rest >> 63) != 0;
+			rest = (rest << 1) | ((bit >= 64 ? high >> (bit - 64) : low >> bit) & 1);
+			quotient <<= 1;
+
+			if (carry || rest >= divisor)
+			{
+				rest -= divisor;
+				quotient |= 1;
+			}
+		}
+
+		return negative ? (int64)(0 - quotient) : (int64)quotient;
+	#endif
+	}
+
+	/** floor(sqrt(value * 2^shift)) for shift < 64 */
+	inline uInt64 SquareRootShift(uInt64 value, uInt32 shift)
+	{
+		if (value == 0)
+		{
+			return 0;
+		}
+
+		const uInt64 targetHigh	= shift ? value >> (64 - shift) : 0;
+		const uInt64 targetLow	= value << shift;
+
+		// Compare root^2 against the 128 bit target
+		const auto greater = [&](uInt64 root)
+		{
+			uInt64 high, low;
+			MultiplyWide(root, root, high, low);
+			return high > targetHigh || (high == targetHigh && low > targetLow);
+		};
+
+		// The double estimate is within one of the result, the integer
+		// corrections make it exact and so independent of the FPU
+		uInt64 root = (uInt64)sqrt(ldexp((double)value, (int)shift));
+
+		while (root > 0 && greater(root))
+		{
+			root--;
+		}
+
+		while (!greater(root + 1))
+		{
+			root++;
+		}
+
+		return root;
+	}
+
+	template<typename StorageType, uInt32 fractionBits>
+	struct Fixed
+	{
+		static_assert(std::is_same_v<StorageType, int32> || std::is_same_v<StorageType, int64>,
+			"Fixed storage must be int32 or int64");
+		static_assert(fractionBits > 0 && fractionBits < sizeof(StorageType) * 8 - 1,
+			"Fixed needs at least one fraction and one integer bit");
+
+		using UnsignedType = std::make_unsigned_t<StorageType>;
+
+		static constexpr StorageType one = (StorageType)1 << fractionBits;
+
+		StorageType value;
+
+		Fixed() = default;
+
+		constexpr Fixed(int32 integer) :
+			value((StorageType)((UnsignedType)(StorageType)integer << fractionBits)) { }
+
+		constexpr Fixed(float number) :
+			value(FromDouble((double)number)) { }
+
+		constexpr Fixed(double number) :
+			value(FromDouble(number)) { }
+
+		/** Construct from the raw two's complement value */
+		static constexpr Fixed FromRaw(StorageType raw)
+		{
+			Fixed fixed{};
+			fixed.value = raw;
+			return fixed;
+		}
+
+		/** Round to nearest, ties away from zero */
+		static constexpr StorageType FromDouble(double number)
+		{
+			const double scaled = number * (double)one;
+			return (StorageType)(scaled >= 0.0 ? scaled + 0.5 : scaled - 0.5);
+		}
+
+		explicit constexpr operator float() const
+		{
+			return (float)((double)value / (double)one);
+		}
+
+		explicit constexpr operator double() const
+		{
+			return (double)value / (double)one;
+		}
+
+		/** Integer part, rounded toward negative infinity */
+		explicit constexpr operator int32() const
+		{
+			return (int32)(value >> fractionBits);
+		}
+
+		friend constexpr Fixed operator+(Fixed a, Fixed b)
+		{
+			return FromRaw((StorageType)((UnsignedType)a.value + (UnsignedType)b.value));
+		}
+
+		friend constexpr Fixed operator-(Fixed a, Fixed b)
+		{
+			return FromRaw((StorageType)((UnsignedType)a.value - (UnsignedType)b.value));
+		}
+
+		friend constexpr Fixed operator-(Fixed a)
+		{
+			return FromRaw((StorageType)(0 - (UnsignedType)a.value));
+		}
+
+		friend inline Fixed operator*(Fixed a, Fixed b)
+		{
+			if constexpr (sizeof(StorageType) == 4)
+			{
+				const int64 product = (int64)a.value * b.value + ((int64)1 << (fractionBits - 1));
+				return FromRaw((StorageType)(product >> fractionBits));
+			}
+			else
+			{
+				return FromRaw(MultiplyShift(a.value, b.value, fractionBits));
+			}
+		}
+
+		friend inline Fixed operator/(Fixed a, Fixed b)
+		{
+			if constexpr (sizeof(StorageType) == 4)
+			{
+				return FromRaw((StorageType)(((int64)a.value * one) / b.value));
+			}
+			else
+			{
+				return FromRaw(DivideShift(a.value, b.value, fractionBits));
+			}
+		}
+
+		constexpr Fixed& operator+=(Fixed fixed)
+		{
+			return *this = *this + fixed;
+		}
+
+		constexpr Fixed& operator-=(Fixed fixed)
+		{
+			return *this = *this - fixed;
+		}
+
+		inline Fixed& operator*=(Fixed fixed)
+		{
+			return *this = *this * fixed;
+		}
+
+		inline Fixed& operator/=(Fixed fixed)
+		{
+			return *this = *this / fixed;
+		}
+
+		friend constexpr bool operator==(Fixed a, Fixed b) { return a.value == b.value; }
+		friend constexpr bool operator!=(Fixed a, Fixed b) { return a.value != b.value; }
+		friend constexpr bool operator<(Fixed a, Fixed b) { return a.value < b.value; }
+		friend constexpr bool operator<=(Fixed a, Fixed b) { return a.value <= b.value; }
+		friend constexpr bool operator>(Fixed a, Fixed b) { return a.value > b.value; }
+		friend constexpr bool operator>=(Fixed a, Fixed b) { return a.value >= b.value; }
+	};
+
+	typedef Fixed<int32, 16> Fixed32;
+	typedef Fixed<int64, 32> Fixed64;
+
+	/** Square root, exact to the last fraction bit (rounded down). Negative values give 0 */
+	template<Precision precision = Precision::Fast, typename StorageType, uInt32 fractionBits>
+	inline Fixed<StorageType, fractionBits> SquareRoot(Fixed<StorageType, fractionBits> number)
+	{
+		if (number.value <= 0)
+		{
+			return Fixed<StorageType, fractionBits>::FromRaw(0);
+		}
+
+		return Fixed<StorageType, fractionBits>::FromRaw(
+			(StorageType)SquareRootShift((uInt64)number.value, fractionBits));
+	}
+
+	/** Inverse square root, 1 / SquareRoot(number). Values <= 0 give 0 so zero vectors normalize to zero. Precision has no effect on Fixed */
+	template<Precision precision = Precision::Fast, typename StorageType, uInt32 fractionBits>
+	inline Fixed<StorageType, fractionBits> InverseSqrt(Fixed<StorageType, fractionBits> number)
+	{
+		if (number.value <= 0)
+		{
+			return Fixed<StorageType, fractionBits>::FromRaw(0);
+		}
+
+		return Fixed<StorageType, fractionBits>(1) / SquareRoot(number);
+	}
+
+	template<typename StorageType, uInt32 fractionBits>
+	inline Fixed<StorageType, fractionBits> FastInvsereSquare(Fixed<StorageType, fractionBits> number)
+	{
+		return InverseSqrt(number);
+	}
+
+	/*====================================================
+	|               QUARTZMATH FIXED TRIG                |
+	=====================================================*/
+
+	// Sine and cosine interpolate a quarter wave table of 1024 steps in Q2.30,
+	// built at compile time. Angles are reduced to a 32 bit phase (2^32 per
+	// turn) by a 64 bit integer multiply, so any angle in range is valid.
+	// Maximum error is 3e-7 (plus rounding to the result type): below the
+	// Fixed32 resolution, and the accuracy limit for Fixed64.
+
+	static constexpr int32 FIXED_SINE_TABLE_SIZE = 1024;
+
+	struct FixedSineTable
+	{
+		int32 values[FIXED_SINE_TABLE_SIZE + 2];
+
+		constexpr FixedSineTable() :
+			values()
+		{
+			for (int32 i = 0; i < FIXED_SINE_TABLE_SIZE + 2; i++)
+			{
+				// The extra entry repeats sin(pi / 2) so interpolation never reads past the end
+				const int32 step	= i > FIXED_SINE_TABLE_SIZE ? FIXED_SINE_TABLE_SIZE : i;
+				const double x		= step * (1.57079632679489662 / FIXED_SINE_TABLE_SIZE);
+
+				// Taylor series, converged far below the Q2.30 resolution on [0, pi/2]
+				double term	= x;
+				double sum	= x;
+
+				for (int32 n = 1; n < 12; n++)
+				{
+					term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+					sum += term;
+				}
+
+				values[i] = (int32)(sum * 1073741824.0 + 0.5);
+			}
+		}
+	};
+
+	inline constexpr FixedSineTable FIXED_SINE_TABLE;
+
+	/** Sine of a 32 bit phase in Q2.30 */
+	inline int32 FixedSinePhase(uInt32 phase)
+	{
+		// Position in the quadrant, mirrored in the odd quadrants
+		uInt32 position = phase & 0x3fffffffu;
+
+		if (phase & 0x40000000u)
+		{
+			position = 0x40000000u - position;
+		}
+
+		const uInt32 index		= position >> 20;
+		const int64 fraction	= position & 0xfffff;
+		const int32 low			= FIXED_SINE_TABLE.values[index];
+		const int32 high		= FIXED_SINE_TABLE.values[index + 1];
+		const int32 sine		= low + (int32)(((high - low) * fraction + 0x80000) >> 20);
+
+		return (phase & 0x80000000u) ? -sine : sine;
+	}
+
+	/** Angle in radians to a 32 bit phase */
+	template<typename StorageType, uInt32 fractionBits>
+	inline uInt32 FixedPhase(Fixed<StorageType, fractionBits> angle)
+	{
+		// round(2^64 / (2 pi)), the phase is bits [fractionBits + 32, fractionBits + 64)
+		// of the product, which the low 128 bits hold for any angle
+		const uInt64 turnScale = 2935890503282001226ull;
+		const uInt32 shift = fractionBits + 32;
+
+		uInt64 high, low;
+		MultiplyWide((uInt64)(int64)angle.value, turnScale, high, low);
+		high -= angle.value < 0 ? turnScale : 0;
+
+		if constexpr (fractionBits + 32 >= 64)
+		{
+			return (uInt32)(high >> (shift - 64));
+		}
+		else
+		{
+			return (uInt32)((low >> shift) | (high << (64 - shift)));
+		}
+	}
+
+	/** Q2.30 to Fixed, rounded to nearest */
+	template<typename StorageType, uInt32 fractionBits>
+	inline Fixed<StorageType, fractionBits> FixedFromQ30(int32 value)
+	{
+		if constexpr (fractionBits < 30)
+		{
+			return Fixed<StorageType, fractionBits>::FromRaw(
+				(StorageType)((value + (1 << (29 - fractionBits))) >> (30 - fractionBits)));
+		}
+		else
+		{
+			using UnsignedType = typename Fixed<StorageType, fractionBits>::UnsignedType;
+			return Fixed<StorageType, fractionBits>::FromRaw(
+				(StorageType)((UnsignedType)(StorageType)value << (fractionBits - 30)));
+		}
+	}
+
+	template<typename StorageType, uInt32 fractionBits>
+	inline Fixed<StorageType, fractionBits> Sin(Fixed<StorageType, fractionBits> angle)
+	{
+		return FixedFromQ30<StorageType, fractionBits>(FixedSinePhase(FixedPhase(angle)));
+	}
+
+	template<typename StorageType, uInt32 fractionBits>
+	inline Fixed<StorageType, fractionBits> Cos(Fixed<StorageType, fractionBits> angle)
+	{
+		return FixedFromQ30<StorageType, fractionBits>(FixedSinePhase(FixedPhase(angle) + 0x40000000u));
+	}
+
+	template<typename StorageType, uInt32 fractionBits>
+	inline void SinCos(Fixed<StorageType, fractionBits> angle,
+		Fixed<StorageType, fractionBits>& sin, Fixed<StorageType, fractionBits>& cos)
+	{
+		const uInt32 phase = FixedPhase(angle);
+		sin = FixedFromQ30<StorageType, fractionBits>(FixedSinePhase(phase));
+		cos = FixedFromQ30<StorageType, fractionBits>(FixedSinePhase(phase + 0x40000000u));
+	}
+
+	/** Tangent of angle, saturated to +-max raw near odd multiples of pi/2 (a cosine of raw 0 takes the sign of the sine) */
+	template<typename StorageType, uInt32 fractionBits>
+	inline Fixed<StorageType, fractionBits> Tan(Fixed<StorageType, fractionBits> angle)
+	{
+		using FixedType		= Fixed<StorageType, fractionBits>;
+		using UnsignedType	= typename FixedType::UnsignedType;
+
+		FixedType sin, cos;
+		SinCos(angle, sin, cos);
+
+		// |sin|, |cos| <= one, so the quotient overflows exactly when |sin| >= |cos| * 2^(bits - 1 - fractionBits)
+		const UnsignedType absSin = (UnsignedType)(sin.value < 0 ? -sin.value : sin.value);
+		const UnsignedType absCos = (UnsignedType)(cos.value < 0 ? -cos.value : cos.value);
+
+		if (absSin >= absCos << (sizeof(StorageType) * 8 - 1 - fractionBits))
+		{
+			const StorageType max = (StorageType)((UnsignedType)-1 >> 1);
+			return FixedType::FromRaw((sin.value < 0) != (cos.value < 0) ? -max : max);
+		}
+
+		return sin / cos;
+	}
+
+	/** Fixed SinCos for Quaternion::SetAxisAngle and SetEuler */
+	template<typename StorageType, uInt32 fractionBits>
+	inline void TrigSinCos(Fixed<StorageType, fractionBits> x,
+		Fixed<StorageType, fractionBits>& sin, Fixed<StorageType, fractionBits>& cos)
+	{
+		SinCos(x, sin, cos);
+	}
+
+	/** Fixed Tan for Matrix4::SetPerspective */
+	template<typename StorageType, uInt32 fractionBits>
+	inline Fixed<StorageType, fractionBits> TrigTan(Fixed<StorageType, fractionBits> x)
+	{
+		return Tan(x);
+	}
+}
@@ -0,0 +1,378 @@
+#pragma once
+
+#include "Simd.h"
+#include "Vector.h"
+
+namespace Quartz
+{
+	/*====================================================
+	|                  QUARTZMATH HALF                   |
+	=====================================================*/
+
+	// Half (IEEE 754 binary16) and BFloat16 (the upper 16 bits of a float)
+	// are storage types: they convert implicitly to and from float and do no
+	// arithmetic of their own, so Vector2/3/4<Half> are used for vertex and
+	// instance data and converted to Vec*f for math.
+	//
+	// Float to half and bfloat16 rounds to nearest even. Half keeps 11
+	// significant bits (relative error 4.9e-4) over [6.1e-5, 65504], with
+	// subnormals down to 6e-8, and overflows to infinity. BFloat16 keeps 8
+	// significant bits (relative error 3.9e-3) over the whole float range.
+	// NaNs stay NaN. Half to float and bfloat16 to float are exact.
+
+	/** Round a float to the nearest half, as bits */
+	inline uInt16 FloatToHalfBits(float value)
+	{
+	#if QMATH_F16C
+		return (uInt16)_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT);
+	#else
+		uInt32 bits;
+		memcpy(&bits, &value, sizeof(float));
+
+		const uInt32 sign = bits & 0x80000000u;
+		bits ^= sign;
+
+		uInt16 result;
+
+		if (bits >= 0x47800000u)
+		{
+			// 65536 and up overflow to infinity, NaNs become quiet NaNs
+			result = bits > 0x7f800000u ? 0x7e00 : 0x7c00;
+		}
+		else if (bits < 0x38800000u)
+		{
+			// Subnormal halves: adding 0.5 lines the half mantissa up with
+			// the float mantissa, so the float addition rounds it
+			float aligned;
+			memcpy(&aligned, &bits, sizeof(float));
+			aligned += 0.5f;
+			memcpy(&bits, &aligned, sizeof(float));
+			result = (uInt16)(bits - 0x3f000000u);
+		}
+		else
+		{
+			// Rebias the exponent and round the 13 dropped mantissa bits to nearest even
+			const uInt32 odd = (bits >> 13) & 1;
+			bits += 0xc8000fffu + odd;
+			result = (uInt16)(bits >> 13);
+		}
+
+		return result | (uInt16)(sign >> 16);
+	#endif
+	}
+
+	/** Expand half bits to a float */
+	inline float HalfBitsToFloat(uInt16 half)
+	{
+	#if QMATH_F16C
+		return _cvtsh_ss(half);
+	#else
+		uInt32 bits = (uInt32)(half & 0x7fff) << 13;
+		const uInt32 exponent = bits & 0x0f800000u;
+
+		bits += 0x38000000u;
+
+		if (exponent == 0x0f800000u)
+		{
+			// Infinity and NaN
+			bits += 0x38000000u;
+		}
+		else if (exponent == 0)
+		{
+			// Subnormal half, renormalized by the float subtraction
+			float value;
+			bits += 0x00800000u;
+			memcpy(&value, &bits, sizeof(float));
+			value -= 6.103515625e-05f;
+			memcpy(&bits, &value, sizeof(float));
+		}
+
+		bits |= (uInt32)(half & 0x8000) << 16;
+
+		float result;
+		memcpy(&result, &bits, sizeof(float));
+		return result;
+	#endif
+	}
+
+	/** Round a float to the nearest bfloat16, as bits */
+	inline uInt16 FloatToBFloat16Bits(float value)
+	{
+		uInt32 bits;
+		memcpy(&bits, &value, sizeof(float));
+
+		if ((bits & 0x7fffffffu) > 0x7f800000u)
+		{
+			return (uInt16)((bits >> 16) | 0x0040);
+		}
+
+		return (uInt16)((bits + 0x7fffu + ((bits >> 16) & 1)) >> 16);
+	}
+
+	/** Expand bfloat16 bits to a float */
+	inline float BFloat16BitsToFloat(uInt16 bfloat)
+	{
+		const uInt32 bits = (uInt32)bfloat << 16;
+
+		float result;
+		memcpy(&result, &bits, sizeof(float));
+		return result;
+	}
+
+	struct Half
+	{
+		uInt16 bits;
+
+		Half() = default;
+
+		inline Half(float value) :
+			bits(FloatToHalfBits(value)) { }
+
+		inline operator float() const
+		{
+			return HalfBitsToFloat(bits);
+		}
+
+		static constexpr Half FromBits(uInt16 bits)
+		{
+			Half half{};
+			half.bits = bits;
+			return half;
+		}
+	};
+
+	struct BFloat16
+	{
+		uInt16 bits;
+
+		BFloat16() = default;
+
+		inline BFloat16(float value) :
+			bits(FloatToBFloat16Bits(value)) { }
+
+		inline operator float() const
+		{
+			return BFloat16BitsToFloat(bits);
+		}
+
+		static constexpr BFloat16 FromBits(uInt16 bits)
+		{
+			BFloat16 bfloat{};
+			bfloat.bits = bits;
+			return bfloat;
+		}
+	};
+
+	typedef Vector2<Half>		Vec2h;
+	typedef Vector3<Half>		Vec3h;
+	typedef Vector4<Half>		Vec4h;
+
+	typedef Vector2<BFloat16>	Vec2bf;
+	typedef Vector3<BFloat16>	Vec3bf;
+	typedef Vector4<BFloat16>	Vec4bf;
+
+	/*====================================================
+	|               QUARTZMATH HALF BATCH                |
+	=====================================================*/
+
+	// Bulk conversions between float and Half / BFloat16 arrays, and between
+	// Vec*f and Vec*h / Vec*bf arrays. Half uses F16C (16 lanes with AVX512)
+	// when QMATH_F16C is set and the same bit manipulation as the scalar
+	// conversion on SSE2 lanes otherwise. BFloat16 uses SSE2. Results are
+	// identical on every path. in and out may not overlap.
+
+	/** out[i] = Half(in[i]) for count values */
+	inline void Convert(const float* in, Half* out, uSize count)
+	{
+		uSize i = 0;
+
+	#if QMATH_AVX512
+		for (; i + 16 <= count; i += 16)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+				_mm512_cvtps_ph(_mm512_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+		}
+	#endif
+
+	#if QMATH_F16C
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+				_mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+		}
+	#elif QMATH_SSE2
+		const __m128i signMask		= _mm_set1_epi32((int32)0x80000000u);
+		const __m128i halfMax		= _mm_set1_epi32(0x47800000);
+		const __m128i normalMin		= _mm_set1_epi32(0x38800000);
+		const __m128i subnormalBias	= _mm_set1_epi32(0x3f000000);
+		const __m128i normalBias	= _mm_set1_epi32((int32)0xc8000fffu);
+		const __m128i infinity		= _mm_set1_epi32(0x7c00);
+		const __m128i nanBit		= _mm_set1_epi32(0x0200);
+
+		// FloatToHalfBits on four lanes, sign extended so the saturating pack keeps them exactly
+		const auto round = [&](__m128 values)
+		{
+			const __m128i bits		= _mm_castps_si128(values);
+			const __m128i sign		= _mm_and_si128(bits, signMask);
+			const __m128i absBits	= _mm_xor_si128(bits, sign);
+
+			const __m128i nan		= _mm_castps_si128(_mm_cmpunord_ps(values, values));
+			const __m128i regular	= _mm_cmpgt_epi32(halfMax, absBits);
+			const __m128i subnormal	= _mm_cmpgt_epi32(normalMin, absBits);
+
+			const __m128i aligned	= _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(absBits),
+				_mm_castsi128_ps(subnormalBias))), subnormalBias);
+			const __m128i odd		= _mm_srai_epi32(_mm_slli_epi32(absBits, 18), 31);
+			const __m128i normal	= _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absBits, normalBias), odd), 13);
+
+			const __m128i finite	= _mm_or_si128(_mm_and_si128(subnormal, aligned), _mm_andnot_si128(subnormal, normal));
+			const __m128i special	= _mm_or_si128(infinity, _mm_and_si128(nan, nanBit));
+			const __m128i result	= _mm_or_si128(_mm_or_si128(_mm_and_si128(regular, finite),
+				_mm_andnot_si128(regular, special)), _mm_srli_epi32(sign, 16));
+
+			return _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+		};
+
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+				_mm_packs_epi32(round(_mm_loadu_ps(in + i)), round(_mm_loadu_ps(in + i + 4))));
+		}
+	#endif
+
+		for (; i < count; i++)
+		{
+			out[i] = Half(in[i]);
+		}
+	}
+
+	/** out[i] = float(in[i]) for count values */
+	inline void Convert(const Half* in, float* out, uSize count)
+	{
+		uSize i = 0;
+
+	#if QMATH_AVX512
+		for (; i + 16 <= count; i += 16)
+		{
+			_mm512_storeu_ps(out + i,
+				_mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i))));
+		}
+	#endif
+
+	#if QMATH_F16C
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(out + i,
+				_mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+		}
+	#elif QMATH_SSE2
+		const __m128i zero			= _mm_setzero_si128();
+		const __m128i magnitudeMask	= _mm_set1_epi32(0x7fff);
+		const __m128i finiteMax		= _mm_set1_epi32(0x7bff);
+		const __m128i exponentMask	= _mm_set1_epi32(0x7f800000);
+		const __m128 rebias			= _mm_set1_ps(5.192296858534828e+33f);
+
+		// Shift into float position and rebias by multiplying with 2^112, which
+		// also normalizes subnormal halves. Infinity and NaN get a full exponent
+		const auto expand = [&](__m128i halves)
+		{
+			const __m128i magnitude	= _mm_and_si128(halves, magnitudeMask);
+			const __m128i sign		= _mm_slli_epi32(_mm_xor_si128(halves, magnitude), 16);
+			const __m128 scaled		= _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(magnitude, 13)), rebias);
+			const __m128i special	= _mm_and_si128(_mm_cmpgt_epi32(magnitude, finiteMax), exponentMask);
+			return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, special)));
+		};
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+			_mm_storeu_ps(out + i, expand(_mm_unpacklo_epi16(halves, zero)));
+			_mm_storeu_ps(out + i + 4, expand(_mm_unpackhi_epi16(halves, zero)));
+		}
+	#endif
+
+		for (; i < count; i++)
+		{
+			out[i] = in[i];
+		}
+	}
+
+	/** out[i] = BFloat16(in[i]) for count values */
+	inline void Convert(const float* in, BFloat16* out, uSize count)
+	{
+		uSize i = 0;
+
+	#if QMATH_SSE2
+		const __m128i one		= _mm_set1_epi32(1);
+		const __m128i bias		= _mm_set1_epi32(0x7fff);
+		const __m128i quiet		= _mm_set1_epi32(0x00400000);
+
+		// Rounded upper halves, sign extended so the saturating pack keeps them exactly
+		const auto round = [&](__m128 values)
+		{
+			const __m128i bits		= _mm_castps_si128(values);
+			const __m128i nan		= _mm_castps_si128(_mm_cmpunord_ps(values, values));
+			const __m128i lsb		= _mm_and_si128(_mm_srli_epi32(bits, 16), one);
+			const __m128i rounded	= _mm_add_epi32(bits, _mm_add_epi32(bias, lsb));
+			const __m128i selected	= _mm_or_si128(_mm_and_si128(nan, _mm_or_si128(bits, quiet)),
+				_mm_andnot_si128(nan, rounded));
+			return _mm_srai_epi32(selected, 16);
+		};
+
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+				_mm_packs_epi32(round(_mm_loadu_ps(in + i)), round(_mm_loadu_ps(in + i + 4))));
+		}
+	#endif
+
+		for (; i < count; i++)
+		{
+			out[i] = BFloat16(in[i]);
+		}
+	}
+
+	/** out[i] = float(in[i]) for count values */
+	inline void Convert(const BFloat16* in, float* out, uSize count)
+	{
+		uSize i = 0;
+
+	#if QMATH_SSE2
+		const __m128i zero = _mm_setzero_si128();
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m128i bfloats = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+			_mm_storeu_ps(out + i, _mm_castsi128_ps(_mm_unpacklo_epi16(zero, bfloats)));
+			_mm_storeu_ps(out + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, bfloats)));
+		}
+	#endif
+
+		for (; i < count; i++)
+		{
+			out[i] = in[i];
+		}
+	}
+
+	/** Convert count Vec2f, Vec3f or Vec4f to the matching Half or BFloat16 vectors */
+	template<template<typename> class VectorType, typename StorageType>
+	inline void Convert(const VectorType<float>* in, VectorType<StorageType>* out, uSize count)
+	{
+		static_assert(sizeof(VectorType<float>) == 2 * sizeof(VectorType<StorageType>),
+			"Vectors must be tightly packed");
+
+		Convert(reinterpret_cast<const float*>(in), reinterpret_cast<StorageType*>(out),
+			count * (sizeof(VectorType<float>) / sizeof(float)));
+	}
+
+	/** Convert count Half or BFloat16 vectors to the matching Vec2f, Vec3f or Vec4f */
+	template<template<typename> class VectorType, typename StorageType>
+	inline void Convert(const VectorType<StorageType>* in, VectorType<float>* out, uSize count)
+	{
+		static_assert(sizeof(VectorType<float>) == 2 * sizeof(VectorType<StorageType>),
+			"Vectors must be tightly packed");
+
+		Convert(reinterpret_cast<const StorageType*>(in), reinterpret_cast<float*>(out),
+			count * (sizeof(VectorType<float>) / sizeof(float)));
+	}
+}
@@ -1,10 +1,23 @@
 #pragma once
 
 #include "Util.h"
+#include "Simd.h"
+#include "FastTrig.h"
 #include "Noise.h"
+#include "NoiseField.h"
 #include "Point.h"
 #include "Vector.h"
+#include "VectorSoA.h"
 #include "Bounds.h"
 #include "Matrix.h"
+#include "Affine.h"
 #include "Quaternion.h"
-#include "Transform.h"
\ No newline at end of file
+#include "Transform.h"
+#include "DualQuaternion.h"
+#include "Batch.h"
+#include "TransformHierarchy.h"
+#include "Frustum.h"
+#include "Bvh.h"
+#include "Compression.h"
+#include "Half.h"
+#include "Fixed.h"
\ No newline at end of file
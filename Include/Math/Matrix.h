@@ -91,10 +91,10 @@ namespace Quartz
 		/** Set to a rotation matrix */
 		constexpr Matrix3& SetRotation(const Quaternion<IntType>& rotation)
 		{
-			float qx = rotation.x;
-			float qy = rotation.y;
-			float qz = rotation.z;
-			float qw = rotation.w;
+			IntType qx = rotation.x;
+			IntType qy = rotation.y;
+			IntType qz = rotation.z;
+			IntType qw = rotation.w;
 
 			m00 = 1.0f - 2.0f * ((qy * qy) + (qz * qz));
 			m01 = 2.0f * ((qx * qy) + (qz * qw));
@@ -120,7 +120,7 @@ namespace Quartz
 		/** Set to a rotation matrix */
 		constexpr Matrix3& SetRotation(const Vector3<IntType>& euler)
 		{
-			return SetRotation(Quaternion(euler));
+			return SetRotation(Quaternion<IntType>(euler));
 		}
 
 		/** Set to a scale matrix */
@@ -261,7 +261,7 @@ namespace Quartz
 		/** Multiply this by a matrix */
 		constexpr void operator*=(const Matrix3& mat3)
 		{
-			*this = this * mat3;
+			*this = *this * mat3;
 		}
 
 		/** Multiply a Vector3<IntType> to this */
@@ -444,10 +444,10 @@ namespace Quartz
 		/** Set to a rotation matrix */
 		constexpr Matrix4& SetRotation(const Quaternion<IntType>& rotation)
 		{
-			float qx = rotation.x;
-			float qy = rotation.y;
-			float qz = rotation.z;
-			float qw = rotation.w;
+			IntType qx = rotation.x;
+			IntType qy = rotation.y;
+			IntType qz = rotation.z;
+			IntType qw = rotation.w;
 
 			m00 = 1.0f - 2.0f * ((qy * qy) + (qz * qz));
 			m01 =		 2.0f * ((qx * qy) + (qz * qw));
@@ -472,6 +472,70 @@ namespace Quartz
 			return *this;
 		}
 
+		/** Set to scale, then rotation, then translation. Same as SetScale * SetRotation * SetTranslation */
+		constexpr Matrix4& SetTRS(const Vector3<IntType>& translation,
+			const Quaternion<IntType>& rotation, const Vector3<IntType>& scale)
+		{
+			IntType qx = rotation.x;
+			IntType qy = rotation.y;
+			IntType qz = rotation.z;
+			IntType qw = rotation.w;
+
+			// Rows of the rotation matrix scaled by the matching scale axis
+			m00 = (1.0f - 2.0f * ((qy * qy) + (qz * qz))) * scale.x;
+			m01 = (		  2.0f * ((qx * qy) + (qz * qw))) * scale.x;
+			m02 = (		  2.0f * ((qx * qz) - (qy * qw))) * scale.x;
+			m03 = 0.0f;
+
+			m10 = (		  2.0f * ((qx * qy) - (qz * qw))) * scale.y;
+			m11 = (1.0f - 2.0f * ((qx * qx) + (qz * qz))) * scale.y;
+			m12 = (		  2.0f * ((qy * qz) + (qx * qw))) * scale.y;
+			m13 = 0.0f;
+
+			m20 = (		  2.0f * ((qx * qz) + (qy * qw))) * scale.z;
+			m21 = (		  2.0f * ((qy * qz) - (qx * qw))) * scale.z;
+			m22 = (1.0f - 2.0f * ((qx * qx) + (qy * qy))) * scale.z;
+			m23 = 0.0f;
+
+			m30 = translation.x;
+			m31 = translation.y;
+			m32 = translation.z;
+			m33 = 1.0f;
+
+			return *this;
+		}
+
+		/** Split an affine matrix into translation, rotation and scale, the inverse of SetTRS */
+		constexpr void DecomposeTRS(Vector3<IntType>& translation,
+			Quaternion<IntType>& rotation, Vector3<IntType>& scale) const
+		{
+			// Scale is the length of each row, negated on x for a negative determinant.
+			// Rows must be nonzero and orthogonal (no shear), the last column is ignored
+			IntType sx = Vector3<IntType>(m00, m01, m02).template Magnitude<Precision::Exact>();
+			IntType sy = Vector3<IntType>(m10, m11, m12).template Magnitude<Precision::Exact>();
+			IntType sz = Vector3<IntType>(m20, m21, m22).template Magnitude<Precision::Exact>();
+
+			const IntType determinant =
+				  m00 * (m11 * m22 - m12 * m21)
+				- m01 * (m10 * m22 - m12 * m20)
+				+ m02 * (m10 * m21 - m11 * m20);
+
+			sx = determinant < 0 ? -sx : sx;
+
+			const IntType ix = 1.0f / sx;
+			const IntType iy = 1.0f / sy;
+			const IntType iz = 1.0f / sz;
+
+			RotationToQuatKernel(
+				m00 * ix, m01 * ix, m02 * ix,
+				m10 * iy, m11 * iy, m12 * iy,
+				m20 * iz, m21 * iz, m22 * iz,
+				rotation.x, rotation.y, rotation.z, rotation.w);
+
+			translation = Vector3<IntType>(m30, m31, m32);
+			scale = Vector3<IntType>(sx, sy, sz);
+		}
+
 		/** Set to a rotation matrix */
 		constexpr Matrix4& SetRotation(const Vector3<IntType>& axis, IntType angle)
 		{
@@ -481,7 +545,7 @@ namespace Quartz
 		/** Set to a rotation matrix */
 		constexpr Matrix4& SetRotation(const Vector3<IntType>& euler)
 		{
-			return SetRotation(Quaternion(euler));
+			return SetRotation(Quaternion<IntType>(euler));
 		}
 
 		/** Set to a scale matrix */
@@ -532,7 +596,7 @@ namespace Quartz
 		/** Set to a perspective matrix */
 		constexpr Matrix4& SetPerspective(IntType fov, IntType aspect, IntType zNear, IntType zFar)
 		{
-			IntType fovY = 1.0f / tanf(fov * 0.5f);
+			IntType fovY = 1.0f / TrigTan(IntType(fov * 0.5f));
 			IntType range = (zFar - zNear);
 
 			SetZero();
@@ -771,14 +835,19 @@ namespace Quartz
 		/** Multiply this by a matrix */
 		constexpr void operator*=(const Matrix4& mat4)
 		{
-			*this = this * mat4;
+			*this = *this * mat4;
 		}
 
-		/** Multiply a Vector3<IntType> to this */
+		/** Multiply a Vector3<IntType> to this (w = 1, the resulting w is dropped) */
 		constexpr Vector3<IntType> operator*(const Vector3<IntType>& vec3) const
 		{
-			Vector4<IntType> vec4(vec3, 1.0f);
-			return operator*(vec4).xyz();
+			Vector3<IntType> result;
+
+			result.x = m00 * vec3.x + m10 * vec3.y + m20 * vec3.z + m30;
+			result.y = m01 * vec3.x + m11 * vec3.y + m21 * vec3.z + m31;
+			result.z = m02 * vec3.x + m12 * vec3.y + m22 * vec3.z + m32;
+
+			return result;
 		}
 
 		/** Multiply a Vector4<IntType> to this */
@@ -840,6 +909,71 @@ namespace Quartz
 		}
 	};
 
+#if QMATH_SSE2
+
+	/*====================================================
+	|              QUARTZMATH MATRIX4 (SIMD)             |
+	=====================================================*/
+
+	// Matrix4<float> keeps the generic row major layout. Each result row is
+	// the matching row of the left operand multiplied by the right matrix, so
+	// every product is four broadcasts and four (fused) multiply-adds.
+
+	template<>
+	inline Matrix4<float> Matrix4<float>::operator*(const Matrix4<float>& mat4) const
+	{
+		Matrix4<float> result;
+
+		const __m128 row0 = Simd::Load4(mat4.m[0]);
+		const __m128 row1 = Simd::Load4(mat4.m[1]);
+		const __m128 row2 = Simd::Load4(mat4.m[2]);
+		const __m128 row3 = Simd::Load4(mat4.m[3]);
+
+		Simd::Store4(result.m[0], Simd::MulRows4(Simd::Load4(m[0]), row0, row1, row2, row3));
+		Simd::Store4(result.m[1], Simd::MulRows4(Simd::Load4(m[1]), row0, row1, row2, row3));
+		Simd::Store4(result.m[2], Simd::MulRows4(Simd::Load4(m[2]), row0, row1, row2, row3));
+		Simd::Store4(result.m[3], Simd::MulRows4(Simd::Load4(m[3]), row0, row1, row2, row3));
+
+		return result;
+	}
+
+	template<>
+	inline Vector4<float> Matrix4<float>::operator*(const Vector4<float>& vec4) const
+	{
+		Vector4<float> result;
+
+		const __m128 row0 = Simd::Load4(m[0]);
+		const __m128 row1 = Simd::Load4(m[1]);
+		const __m128 row2 = Simd::Load4(m[2]);
+		const __m128 row3 = Simd::Load4(m[3]);
+
+		Simd::Store4(result.e, Simd::MulRows4(Simd::Load4(vec4.e), row0, row1, row2, row3));
+
+		return result;
+	}
+
+	template<>
+	inline Matrix4<float> Matrix4<float>::Transposed() const
+	{
+		Matrix4<float> result;
+
+		__m128 row0 = Simd::Load4(m[0]);
+		__m128 row1 = Simd::Load4(m[1]);
+		__m128 row2 = Simd::Load4(m[2]);
+		__m128 row3 = Simd::Load4(m[3]);
+
+		_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+		Simd::Store4(result.m[0], row0);
+		Simd::Store4(result.m[1], row1);
+		Simd::Store4(result.m[2], row2);
+		Simd::Store4(result.m[3], row3);
+
+		return result;
+	}
+
+#endif // QMATH_SSE2
+
 	typedef Matrix4<sSize>	Mat4i;
 	typedef Matrix4<uSize>	Mat4u;
 	typedef Matrix4<float>	Mat4f;
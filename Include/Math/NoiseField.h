@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Noise.h"
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Quartz
+{
+	/*====================================================
+	|                QUARTZMATH NOISE FIELD              |
+	=====================================================*/
+
+	// Noise fields split a width x height grid into square tiles and fill them
+	// on a pool of worker threads. Tiles are dealt to per-worker queues in
+	// contiguous runs so neighbouring tiles share a worker; a worker whose
+	// queue runs dry steals from the back of another worker's queue.
+	//
+	// Every tile is generated with the region functions, which sample the
+	// global grid position origin + step * (col, row), so the output is
+	// identical for any thread count and any tile size. The calling thread
+	// works as one of the workers; threads are created per call, so very small
+	// fields are better served by GenerateNoiseTile2D directly.
+
+	struct NoiseFieldParams
+	{
+		uSize threadCount;	// 0 = std::thread::hardware_concurrency()
+		uSize tileSize;		// tile edge in samples, 64 x 64 floats = 16KB per plane
+
+		NoiseFieldParams(uSize threadCount = 0, uSize tileSize = 64) :
+			threadCount(threadCount), tileSize(tileSize) {}
+	};
+
+	/** A worker's tile queue. The owner pops from the front, thieves take from the back */
+	struct NoiseTileQueue
+	{
+		std::mutex			mutex;
+		std::deque<uSize>	tiles;
+
+		void Push(uSize tile)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			tiles.push_back(tile);
+		}
+
+		bool Pop(uSize& tile)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (tiles.empty())
+			{
+				return false;
+			}
+
+			tile = tiles.front();
+			tiles.pop_front();
+			return true;
+		}
+
+		bool Steal(uSize& tile)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (tiles.empty())
+			{
+				return false;
+			}
+
+			tile = tiles.back();
+			tiles.pop_back();
+			return true;
+		}
+	};
+
+	/** Call tileFunc(firstCol, firstRow, tileWidth, tileHeight) for every tile of a width x height grid */
+	template<typename TileFunc>
+	inline void ForEachNoiseTile(uSize width, uSize height, const NoiseFieldParams& params, TileFunc tileFunc)
+	{
+		const uSize tileSize	= params.tileSize ? params.tileSize : 64;
+		const uSize tilesX		= (width + tileSize - 1) / tileSize;
+		const uSize tilesY		= (height + tileSize - 1) / tileSize;
+		const uSize tileCount	= tilesX * tilesY;
+
+		if (tileCount == 0)
+		{
+			return;
+		}
+
+		uSize threadCount = params.threadCount ? params.threadCount : (uSize)std::thread::hardware_concurrency();
+		threadCount = Clamp<uSize>(1, tileCount, threadCount);
+
+		auto runTile = [&](uSize tile)
+		{
+			const uSize firstCol = (tile % tilesX) * tileSize;
+			const uSize firstRow = (tile / tilesX) * tileSize;
+
+			tileFunc(firstCol, firstRow, Min(tileSize, width - firstCol), Min(tileSize, height - firstRow));
+		};
+
+		if (threadCount == 1)
+		{
+			for (uSize tile = 0; tile < tileCount; tile++)
+			{
+				runTile(tile);
+			}
+
+			return;
+		}
+
+		std::vector<NoiseTileQueue> queues(threadCount);
+
+		for (uSize tile = 0; tile < tileCount; tile++)
+		{
+			queues[tile * threadCount / tileCount].Push(tile);
+		}
+
+		// Nothing is queued after this point, so a worker that finds every queue empty is done
+		auto worker = [&](uSize index)
+		{
+			uSize tile;
+
+			for (;;)
+			{
+				if (queues[index].Pop(tile))
+				{
+					runTile(tile);
+					continue;
+				}
+
+				bool stolen = false;
+
+				for (uSize offset = 1; offset < threadCount && !stolen; offset++)
+				{
+					stolen = queues[(index + offset) % threadCount].Steal(tile);
+				}
+
+				if (!stolen)
+				{
+					return;
+				}
+
+				runTile(tile);
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount - 1);
+
+		for (uSize index = 1; index < threadCount; index++)
+		{
+			threads.emplace_back(worker, index);
+		}
+
+		worker(0);
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	/** Fill a width x height grid of 2D perlin noise on worker threads, optionally with derivative planes */
+	inline void GenerateNoiseField(const NoiseContext& context, const Vec2f& origin, const Vec2f& step,
+		uSize width, uSize height, float* out, float* outDx = nullptr, float* outDy = nullptr,
+		const NoiseFieldParams& params = NoiseFieldParams())
+	{
+		const bool deriv = outDx != nullptr && outDy != nullptr;
+
+		ForEachNoiseTile(width, height, params, [&](uSize firstCol, uSize firstRow, uSize tileWidth, uSize tileHeight)
+		{
+			const uSize offset = firstRow * width + firstCol;
+
+			GenerateNoiseRegion2D(context, origin, step, firstCol, firstRow, tileWidth, tileHeight, width,
+				out + offset, deriv ? outDx + offset : nullptr, deriv ? outDy + offset : nullptr);
+		});
+	}
+
+	/** Fill a width x height grid of fractal noise on worker threads */
+	inline void GenerateNoiseField(const NoiseContext& context, const FractalParams& fractal,
+		const Vec2f& origin, const Vec2f& step, uSize width, uSize height, float* out,
+		const NoiseFieldParams& params = NoiseFieldParams())
+	{
+		ForEachNoiseTile(width, height, params, [&](uSize firstCol, uSize firstRow, uSize tileWidth, uSize tileHeight)
+		{
+			GenerateFractalRegion2D(context, fractal, origin, step, firstCol, firstRow, tileWidth, tileHeight, width,
+				out + firstRow * width + firstCol);
+		});
+	}
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Vector.h"
+#include "FastTrig.h"
 
 #include <cmath>
 
@@ -66,8 +67,8 @@ namespace Quartz
 		/** Set a Quaternion from axis and angle */
 		constexpr Quaternion& SetAxisAngle(const Vector3<IntType>& axis, IntType angle)
 		{
-			IntType sinHalfAngle = sinf(angle * 0.5f);
-			IntType cosHalfAngle = cosf(angle * 0.5f);
+			IntType sinHalfAngle, cosHalfAngle;
+			TrigSinCos(IntType(angle * 0.5f), sinHalfAngle, cosHalfAngle);
 
 			this->x = axis.x * sinHalfAngle;
 			this->y = axis.y * sinHalfAngle;
@@ -80,12 +81,10 @@ namespace Quartz
 		/** Set a Quaternion from euler angles */
 		constexpr Quaternion& SetEuler(const Vector3<IntType>& euler)
 		{
-			IntType cx = cosf(euler.x * 0.5f);
-			IntType cy = cosf(euler.y * 0.5f);
-			IntType cz = cosf(euler.z * 0.5f);
-			IntType sx = sinf(euler.x * 0.5f);
-			IntType sy = sinf(euler.y * 0.5f);
-			IntType sz = sinf(euler.z * 0.5f);
+			IntType sx, sy, sz, cx, cy, cz;
+			TrigSinCos(IntType(euler.x * 0.5f), sx, cx);
+			TrigSinCos(IntType(euler.y * 0.5f), sy, cy);
+			TrigSinCos(IntType(euler.z * 0.5f), sz, cz);
 
 			this->x = cx * sy * sz + cy * cz * sx;
 			this->y = cx * cz * sy - cy * sx * sz;
@@ -96,15 +95,17 @@ namespace Quartz
 		}
 
 		/** Get the magnitude of this quaternion */
+		template<Precision precision = Precision::Fast>
 		IntType Magnitude() const
 		{
-			return 1.0f / FastInvsereSquare(MagnitudeSquared());
+			return SquareRoot<precision>(MagnitudeSquared());
 		}
 
 		/** Get the inverse of the magnitude of this quaternion */
+		template<Precision precision = Precision::Fast>
 		IntType InverseMagnitude() const
 		{
-			return FastInvsereSquare(MagnitudeSquared());
+			return InverseSqrt<precision>(MagnitudeSquared());
 		}
 
 		/** Get the squared magnitude of this quaternion */
@@ -114,9 +115,10 @@ namespace Quartz
 		}
 
 		/** Normalize this quaternion */
+		template<Precision precision = Precision::Fast>
 		Quaternion& Normalize()
 		{
-			IntType inverse = InverseMagnitude();
+			IntType inverse = InverseMagnitude<precision>();
 			this->x *= inverse;
 			this->y *= inverse;
 			this->z *= inverse;
@@ -125,9 +127,10 @@ namespace Quartz
 		}
 
 		/** Get the normalized quaternion */
+		template<Precision precision = Precision::Fast>
 		constexpr Quaternion Normalized() const
 		{
-			IntType inverse = InverseMagnitude();
+			IntType inverse = InverseMagnitude<precision>();
 			IntType rx = x * inverse;
 			IntType ry = y * inverse;
 			IntType rz = z * inverse;
@@ -210,6 +213,18 @@ namespace Quartz
 			return quat * value;
 		}
 
+		/** Add a quaternion to this, component-wise */
+		constexpr Quaternion operator+(const Quaternion& quat) const
+		{
+			return Quaternion(x + quat.x, y + quat.y, z + quat.z, w + quat.w);
+		}
+
+		/** Subtract a quaternion from this, component-wise */
+		constexpr Quaternion operator-(const Quaternion& quat) const
+		{
+			return Quaternion(x - quat.x, y - quat.y, z - quat.z, w - quat.w);
+		}
+
 		/** Divide a quaternion from this */
 		constexpr Quaternion operator/(const Quaternion& quat) const
 		{
@@ -235,6 +250,246 @@ namespace Quartz
 		}
 	};
 
+	/*====================================================
+	|           QUARTZMATH QUATERNION INTERPOLATION      |
+	=====================================================*/
+
+	// Nlerp, Slerp and SlerpFast interpolate along the shortest arc, negating
+	// quat2 when Dot(quat1, quat2) < 0. Maximum error for unit float quaternions,
+	// as the rotation angle between the result and a double precision slerp
+	// of the same float inputs (20M random pairs, with and without FMA), and
+	// the cost per rotation on a 2.1 GHz Xeon with AVX2 (QuartzMathBenchmarks Blend/*):
+	//
+	// Nlerp		0.14 rad, 0.016 rad for rotations up to 90 degrees apart. Not
+	//				constant speed, but the cheapest: 8 ns, 5 ns batched
+	// SlerpFast	1.7e-5 rad, 2.5e-7 rad for rotations up to 90 degrees apart.
+	//				Polynomial slerp without acos / sin (Eberly, "A Fast and
+	//				Accurate Algorithm for Computing SLERP"): 21 ns, 6 ns batched
+	// Slerp		1.2e-6 rad, acos / sin from libm: 40 ns. Nlerp for arcs
+	//				below 0.03 rad, where the two are indistinguishable
+	//
+	// SlerpFastWeights is written once over float and Simd::FloatN and is the
+	// kernel behind the batch Slerp in Batch.h.
+
+	/** Weights of quat1 and quat2 in slerp(quat1, quat2, t), for cosTheta = Dot(quat1, quat2) in [0, 1] */
+	template<typename Type>
+	inline void SlerpFastWeights(Type cosTheta, Type t, Type& weight1, Type& weight2)
+	{
+		// sin(n * theta) / sin(theta) expanded as nested polynomials in (cosTheta - 1),
+		// the last term is scaled by (1 + mu) to minimize the float error
+		static constexpr float u[8] =
+		{
+			1.0f / (1 * 3), 1.0f / (2 * 5), 1.0f / (3 * 7), 1.0f / (4 * 9),
+			1.0f / (5 * 11), 1.0f / (6 * 13), 1.0f / (7 * 15), 1.85298109240830f / (8 * 17)
+		};
+
+		static constexpr float v[8] =
+		{
+			1.0f / 3, 2.0f / 5, 3.0f / 7, 4.0f / 9,
+			5.0f / 11, 6.0f / 13, 7.0f / 15, 1.85298109240830f * 8 / 17
+		};
+
+		const Type one(1.0f);
+		const Type xm1 = cosTheta - one;
+		const Type d = one - t;
+		const Type sqrT = t * t;
+		const Type sqrD = d * d;
+
+		Type sumT = one;
+		Type sumD = one;
+
+		for (int i = 7; i >= 0; i--)
+		{
+			sumT = one + (Type(u[i]) * sqrT - Type(v[i])) * xm1 * sumT;
+			sumD = one + (Type(u[i]) * sqrD - Type(v[i])) * xm1 * sumD;
+		}
+
+		weight1 = d * sumD;
+		weight2 = t * sumT;
+	}
+
+	/** Normalized linear interpolation from quat1 to quat2 along the shortest arc */
+	template<typename IntType, Precision precision = Precision::Fast>
+	inline Quaternion<IntType> Nlerp(const Quaternion<IntType>& quat1, const Quaternion<IntType>& quat2, IntType t)
+	{
+		const IntType weight2 = Dot(quat1, quat2) < 0 ? -t : t;
+		const IntType weight1 = 1 - t;
+
+		return Quaternion<IntType>(
+			quat1.x * weight1 + quat2.x * weight2,
+			quat1.y * weight1 + quat2.y * weight2,
+			quat1.z * weight1 + quat2.z * weight2,
+			quat1.w * weight1 + quat2.w * weight2).template Normalized<precision>();
+	}
+
+	/** Spherical linear interpolation from quat1 to quat2 along the shortest arc */
+	template<typename IntType>
+	inline Quaternion<IntType> Slerp(const Quaternion<IntType>& quat1, const Quaternion<IntType>& quat2, IntType t)
+	{
+		IntType cosTheta = Dot(quat1, quat2);
+		IntType sign = 1;
+
+		if (cosTheta < 0)
+		{
+			cosTheta = -cosTheta;
+			sign = -1;
+		}
+
+		// sin(theta) loses precision near 0, where nlerp is indistinguishable from slerp
+		if (cosTheta > (IntType)0.9995)
+		{
+			return Nlerp<IntType, Precision::Exact>(quat1, quat2, t);
+		}
+
+		const IntType theta		= acos(cosTheta);
+		const IntType invSin	= 1 / sin(theta);
+		const IntType weight1	= sin((1 - t) * theta) * invSin;
+		const IntType weight2	= sin(t * theta) * invSin * sign;
+
+		return Quaternion<IntType>(
+			quat1.x * weight1 + quat2.x * weight2,
+			quat1.y * weight1 + quat2.y * weight2,
+			quat1.z * weight1 + quat2.z * weight2,
+			quat1.w * weight1 + quat2.w * weight2);
+	}
+
+	/** Slerp without acos / sin, see SlerpFastWeights */
+	template<typename IntType>
+	inline Quaternion<IntType> SlerpFast(const Quaternion<IntType>& quat1, const Quaternion<IntType>& quat2, IntType t)
+	{
+		const IntType cosTheta = Dot(quat1, quat2);
+
+		IntType weight1, weight2;
+		SlerpFastWeights<IntType>(cosTheta < 0 ? -cosTheta : cosTheta, t, weight1, weight2);
+
+		if (cosTheta < 0)
+		{
+			weight2 = -weight2;
+		}
+
+		return Quaternion<IntType>(
+			quat1.x * weight1 + quat2.x * weight2,
+			quat1.y * weight1 + quat2.y * weight2,
+			quat1.z * weight1 + quat2.z * weight2,
+			quat1.w * weight1 + quat2.w * weight2);
+	}
+
+	/** Logarithm of a unit quaternion, (axis * angle / 2, 0) */
+	template<typename IntType>
+	inline Quaternion<IntType> Log(const Quaternion<IntType>& quat)
+	{
+		const IntType sinHalfAngle = sqrt(quat.x * quat.x + quat.y * quat.y + quat.z * quat.z);
+
+		if (sinHalfAngle < (IntType)1e-6)
+		{
+			return Quaternion<IntType>(quat.x, quat.y, quat.z, 0);
+		}
+
+		const IntType scale = atan2(sinHalfAngle, quat.w) / sinHalfAngle;
+		return Quaternion<IntType>(quat.x * scale, quat.y * scale, quat.z * scale, 0);
+	}
+
+	/** Exponential of a pure quaternion (w ignored), the inverse of Log */
+	template<typename IntType>
+	inline Quaternion<IntType> Exp(const Quaternion<IntType>& quat)
+	{
+		const IntType halfAngle = sqrt(quat.x * quat.x + quat.y * quat.y + quat.z * quat.z);
+
+		if (halfAngle < (IntType)1e-6)
+		{
+			return Quaternion<IntType>(quat.x, quat.y, quat.z, 1).template Normalized<Precision::Exact>();
+		}
+
+		const IntType scale = sin(halfAngle) / halfAngle;
+		return Quaternion<IntType>(quat.x * scale, quat.y * scale, quat.z * scale, cos(halfAngle));
+	}
+
+	/** Squad control point for key current between keys prev and next */
+	template<typename IntType>
+	inline Quaternion<IntType> SquadControlPoint(const Quaternion<IntType>& prev,
+		const Quaternion<IntType>& current, const Quaternion<IntType>& next)
+	{
+		const Quaternion<IntType> inverse = current.Conjugate();
+		const Quaternion<IntType> logNext = Log(inverse * (Dot(current, next) < 0 ? next * (IntType)-1 : next));
+		const Quaternion<IntType> logPrev = Log(inverse * (Dot(current, prev) < 0 ? prev * (IntType)-1 : prev));
+
+		const IntType scale = (IntType)-0.25;
+		const Quaternion<IntType> sum(
+			(logNext.x + logPrev.x) * scale, (logNext.y + logPrev.y) * scale, (logNext.z + logPrev.z) * scale, 0);
+
+		return current * Exp(sum);
+	}
+
+	/**
+	 * Spherical cubic interpolation from quat1 to quat2 with control points
+	 * control1 and control2 (see SquadControlPoint), C1 continuous across keys
+	 */
+	template<typename IntType>
+	inline Quaternion<IntType> Squad(const Quaternion<IntType>& quat1, const Quaternion<IntType>& control1,
+		const Quaternion<IntType>& control2, const Quaternion<IntType>& quat2, IntType t)
+	{
+		return Slerp(Slerp(quat1, quat2, t), Slerp(control1, control2, t), 2 * t * (1 - t));
+	}
+
+	/*====================================================
+	|        QUARTZMATH QUATERNION FROM ROTATION         |
+	=====================================================*/
+
+	// Quaternion of a rotation matrix (Matrix4::SetRotation layout) by
+	// Shepperd's method: the largest of 4w^2, 4x^2, 4y^2 and 4z^2 is read off
+	// the diagonal and the other components come from the off-diagonal sums
+	// and differences, which keeps the division well conditioned for every
+	// rotation. The case is picked with Select, so the kernel is branch free
+	// over float and Simd::FloatN (Matrix4::DecomposeTRS and DecomposeTRS in
+	// Batch.h). The result is unit length to rounding, the sign is unspecified.
+
+	/** Quaternion of the orthonormal rotation rows (m00 m01 m02) (m10 m11 m12) (m20 m21 m22) */
+	template<typename Type>
+	inline void RotationToQuatKernel(
+		Type m00, Type m01, Type m02,
+		Type m10, Type m11, Type m12,
+		Type m20, Type m21, Type m22,
+		Type& x, Type& y, Type& z, Type& w)
+	{
+		const Type one(1.0f);
+
+		const Type a = m12 - m21;	// 4xw
+		const Type b = m20 - m02;	// 4yw
+		const Type c = m01 - m10;	// 4zw
+		const Type d = m01 + m10;	// 4xy
+		const Type e = m02 + m20;	// 4xz
+		const Type f = m12 + m21;	// 4yz
+
+		const Type tw = one + m00 + m11 + m22;	// 4w^2
+		const Type tx = one + m00 - m11 - m22;	// 4x^2
+		const Type ty = one - m00 + m11 - m22;	// 4y^2
+		const Type tz = one - m00 - m11 + m22;	// 4z^2
+
+		// Numerators of the largest case, where the largest component's slot holds t
+		Type t = tw;
+		Type nx = a, ny = b, nz = c, nw = tw;
+
+		const auto useX = LessThan(t, tx);
+		t = Select(useX, tx, t);
+		nx = Select(useX, tx, nx); ny = Select(useX, d, ny); nz = Select(useX, e, nz); nw = Select(useX, a, nw);
+
+		const auto useY = LessThan(t, ty);
+		t = Select(useY, ty, t);
+		nx = Select(useY, d, nx); ny = Select(useY, ty, ny); nz = Select(useY, f, nz); nw = Select(useY, b, nw);
+
+		const auto useZ = LessThan(t, tz);
+		t = Select(useZ, tz, t);
+		nx = Select(useZ, e, nx); ny = Select(useZ, f, ny); nz = Select(useZ, tz, nz); nw = Select(useZ, c, nw);
+
+		// The largest component is sqrt(t) / 2 = t * k, the others numerator * k
+		const Type k = Type(0.5f) / Sqrt(t);
+
+		x = nx * k;
+		y = ny * k;
+		z = nz * k;
+		w = nw * k;
+	}
+
 	typedef Quaternion<sSize>	Quati;
 	typedef Quaternion<uSize>	Quatu;
 	typedef Quaternion<float>	Quatf;
@@ -0,0 +1,510 @@
+#pragma once
+
+#include "Types.h"
+#include <math.h>
+#include <string.h>
+
+/*====================================================
+|                 QUARTZMATH SIMD CONFIG             |
+=====================================================*/
+
+// SIMD code paths are opt-in. Define QMATH_USE_SIMD to 1 before including
+// any QuartzMath header (or enable QUARTZMATH_USE_SIMD in CMake) to enable them.
+// The instruction sets used are picked from the compiler's target flags.
+#ifndef QMATH_USE_SIMD
+#define QMATH_USE_SIMD 0
+#endif
+
+#if QMATH_USE_SIMD
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define QMATH_SSE2 1
+#endif
+
+#if defined(__AVX__)
+#define QMATH_AVX 1
+#endif
+
+#if defined(__AVX2__)
+#define QMATH_AVX2 1
+#endif
+
+// MSVC does not expose a separate FMA macro, it is implied by /arch:AVX2
+#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define QMATH_FMA 1
+#endif
+
+#if defined(__AVX512F__)
+#define QMATH_AVX512 1
+#endif
+
+// Half precision conversions, MSVC implies F16C with /arch:AVX2
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define QMATH_F16C 1
+#endif
+
+#endif // QMATH_USE_SIMD
+
+#ifndef QMATH_SSE2
+#define QMATH_SSE2 0
+#endif
+
+#ifndef QMATH_AVX
+#define QMATH_AVX 0
+#endif
+
+#ifndef QMATH_AVX2
+#define QMATH_AVX2 0
+#endif
+
+#ifndef QMATH_FMA
+#define QMATH_FMA 0
+#endif
+
+#ifndef QMATH_AVX512
+#define QMATH_AVX512 0
+#endif
+
+#ifndef QMATH_F16C
+#define QMATH_F16C 0
+#endif
+
+// Widest float vector available to batch kernels
+#if QMATH_AVX512
+#define QMATH_SIMD_WIDTH 16
+#elif QMATH_AVX
+#define QMATH_SIMD_WIDTH 8
+#elif QMATH_SSE2
+#define QMATH_SIMD_WIDTH 4
+#else
+#define QMATH_SIMD_WIDTH 1
+#endif
+
+// Batch storage is aligned and padded for the widest supported vector
+// (one cache line) regardless of the flags the library is compiled with.
+#define QMATH_SIMD_ALIGNMENT 64
+#define QMATH_SIMD_MAX_WIDTH 16
+
+#if QMATH_SSE2
+#include <immintrin.h>
+#endif
+
+namespace Quartz
+{
+	/*====================================================
+	|                 QUARTZMATH SIMD FLOAT4             |
+	=====================================================*/
+
+#if QMATH_SSE2
+
+	namespace Simd
+	{
+		/** Check if the caller is being constant evaluated, where intrinsics cannot run */
+		constexpr bool IsConstantEvaluated()
+		{
+			return __builtin_is_constant_evaluated();
+		}
+
+		/** Load four unaligned floats */
+		inline __m128 Load4(const float* values)
+		{
+			return _mm_loadu_ps(values);
+		}
+
+		/** Store four unaligned floats */
+		inline void Store4(float* values, __m128 vec)
+		{
+			_mm_storeu_ps(values, vec);
+		}
+
+		/** Broadcast one lane of a register to all lanes */
+		template<int lane>
+		inline __m128 Splat4(__m128 vec)
+		{
+			return _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(lane, lane, lane, lane));
+		}
+
+		/** Compute a * b + c, fused when FMA is available */
+		inline __m128 MulAdd4(__m128 a, __m128 b, __m128 c)
+		{
+		#if QMATH_FMA
+			return _mm_fmadd_ps(a, b, c);
+		#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+		#endif
+		}
+
+		/** Multiply the row vector vec by the four matrix rows */
+		inline __m128 MulRows4(__m128 vec, __m128 row0, __m128 row1, __m128 row2, __m128 row3)
+		{
+			__m128 result = _mm_mul_ps(Splat4<0>(vec), row0);
+			result = MulAdd4(Splat4<1>(vec), row1, result);
+			result = MulAdd4(Splat4<2>(vec), row2, result);
+			result = MulAdd4(Splat4<3>(vec), row3, result);
+			return result;
+		}
+
+		/** Multiply the xyz of row vector vec by three matrix rows */
+		inline __m128 MulRows3(__m128 vec, __m128 row0, __m128 row1, __m128 row2)
+		{
+			__m128 result = _mm_mul_ps(Splat4<0>(vec), row0);
+			result = MulAdd4(Splat4<1>(vec), row1, result);
+			result = MulAdd4(Splat4<2>(vec), row2, result);
+			return result;
+		}
+	}
+
+#endif // QMATH_SSE2
+
+	/*====================================================
+	|                 QUARTZMATH SIMD SCALAR             |
+	=====================================================*/
+
+	// Float counterparts of the FloatN operations, so kernels can be written
+	// once as templates over float and Simd::FloatN.
+
+	/** Compute a * b + c */
+	inline float MulAdd(float a, float b, float c)
+	{
+		return a * b + c;
+	}
+
+	inline float Floor(float a)
+	{
+		return floorf(a);
+	}
+
+	inline float Sqrt(float a)
+	{
+		return sqrtf(a);
+	}
+
+	inline bool LessThan(float a, float b)
+	{
+		return a < b;
+	}
+
+	/** a where mask is set, otherwise b. Blends bits so data dependent masks do not branch */
+	inline float Select(bool mask, float a, float b)
+	{
+		const uInt32 select = 0u - (uInt32)mask;
+		uInt32 bitsA, bitsB;
+		memcpy(&bitsA, &a, sizeof(float));
+		memcpy(&bitsB, &b, sizeof(float));
+		bitsA = (bitsA & select) | (bitsB & ~select);
+		memcpy(&a, &bitsA, sizeof(float));
+		return a;
+	}
+
+	/** 2^n for integral n in [-126, 127] */
+	inline float Exp2Integer(float n)
+	{
+		const uInt32 bits = (uInt32)((n + 127.0f) * 8388608.0f);
+		float result;
+		memcpy(&result, &bits, sizeof(float));
+		return result;
+	}
+
+	/** Split a positive normal float into a mantissa in [1, 2) and its exponent */
+	inline float SplitExponent(float a, float& exponent)
+	{
+		uInt32 bits;
+		memcpy(&bits, &a, sizeof(float));
+		exponent = (float)(int32)(bits >> 23) - 127.0f;
+		bits = (bits & 0x007fffff) | 0x3f800000;
+		memcpy(&a, &bits, sizeof(float));
+		return a;
+	}
+
+	/*====================================================
+	|                 QUARTZMATH SIMD FLOATN             |
+	=====================================================*/
+
+	namespace Simd
+	{
+		// FloatN wraps the widest float register (QMATH_SIMD_WIDTH lanes) so
+		// batch kernels can be written once. Loads and stores are unaligned.
+		// RSqrt is the hardware estimate (12 bits, 14 with AVX512) and is
+		// normally refined with a Newton step, see FastInvsereSquare.
+		// LoadInterleaved4 reads QMATH_SIMD_WIDTH consecutive groups of four
+		// floats (such as Vec4f) and returns the first members of every group
+		// in a, the second in b and so on.
+		//
+		// LessThan returns a lane mask that is only meaningful to Select and
+		// MaskBits, which packs it into an integer with bit i set for lane i.
+		// Exp2Integer(n) is 2^n for integral n in [-126, 127]. SplitExponent
+		// splits a positive normal float into a mantissa in [1, 2) and its
+		// exponent. Both work on the bit pattern and assume in-range inputs.
+
+#if QMATH_AVX512
+
+		struct FloatN
+		{
+			__m512 v;
+
+			FloatN() = default;
+			FloatN(__m512 v) : v(v) {}
+			explicit FloatN(float value) : v(_mm512_set1_ps(value)) {}
+
+			static FloatN Load(const float* values) { return _mm512_loadu_ps(values); }
+			void Store(float* values) const { _mm512_storeu_ps(values, v); }
+
+			static void LoadInterleaved4(const float* values, FloatN& a, FloatN& b, FloatN& c, FloatN& d)
+			{
+				const __m512 v0 = _mm512_loadu_ps(values),		v1 = _mm512_loadu_ps(values + 16);
+				const __m512 v2 = _mm512_loadu_ps(values + 32),	v3 = _mm512_loadu_ps(values + 48);
+
+				// Regroup so each 128-bit lane k holds groups 4k..4k+3, then transpose within lanes
+				const __m512 e0 = _mm512_shuffle_f32x4(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m512 e1 = _mm512_shuffle_f32x4(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+				const __m512 e2 = _mm512_shuffle_f32x4(v2, v3, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m512 e3 = _mm512_shuffle_f32x4(v2, v3, _MM_SHUFFLE(3, 1, 3, 1));
+
+				const __m512 r0 = _mm512_shuffle_f32x4(e0, e2, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m512 r1 = _mm512_shuffle_f32x4(e1, e3, _MM_SHUFFLE(2, 0, 2, 0));
+				const __m512 r2 = _mm512_shuffle_f32x4(e0, e2, _MM_SHUFFLE(3, 1, 3, 1));
+				const __m512 r3 = _mm512_shuffle_f32x4(e1, e3, _MM_SHUFFLE(3, 1, 3, 1));
+
+				const __m512 t0 = _mm512_unpacklo_ps(r0, r1), t1 = _mm512_unpackhi_ps(r0, r1);
+				const __m512 t2 = _mm512_unpacklo_ps(r2, r3), t3 = _mm512_unpackhi_ps(r2, r3);
+
+				a = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+				b = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+				c = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+				d = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+			}
+
+			friend FloatN operator+(FloatN a, FloatN b) { return _mm512_add_ps(a.v, b.v); }
+			friend FloatN operator-(FloatN a, FloatN b) { return _mm512_sub_ps(a.v, b.v); }
+			friend FloatN operator*(FloatN a, FloatN b) { return _mm512_mul_ps(a.v, b.v); }
+			friend FloatN operator/(FloatN a, FloatN b) { return _mm512_div_ps(a.v, b.v); }
+
+			friend FloatN MulAdd(FloatN a, FloatN b, FloatN c) { return _mm512_fmadd_ps(a.v, b.v, c.v); }
+			friend FloatN Min(FloatN a, FloatN b) { return _mm512_min_ps(a.v, b.v); }
+			friend FloatN Max(FloatN a, FloatN b) { return _mm512_max_ps(a.v, b.v); }
+			friend FloatN Sqrt(FloatN a) { return _mm512_sqrt_ps(a.v); }
+			friend FloatN RSqrt(FloatN a) { return _mm512_rsqrt14_ps(a.v); }
+
+			friend FloatN Abs(FloatN a)
+			{
+				return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a.v), _mm512_set1_epi32(0x7fffffff)));
+			}
+
+			friend FloatN Floor(FloatN a) { return _mm512_roundscale_ps(a.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+
+			friend FloatN LessThan(FloatN a, FloatN b)
+			{
+				return _mm512_castsi512_ps(_mm512_maskz_set1_epi32(_mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ), -1));
+			}
+
+			friend FloatN Select(FloatN mask, FloatN a, FloatN b)
+			{
+				const __m512i bits = _mm512_castps_si512(mask.v);
+				return _mm512_mask_blend_ps(_mm512_test_epi32_mask(bits, bits), b.v, a.v);
+			}
+
+			friend uInt32 MaskBits(FloatN mask)
+			{
+				const __m512i bits = _mm512_castps_si512(mask.v);
+				return (uInt32)_mm512_test_epi32_mask(bits, bits);
+			}
+
+			friend FloatN Exp2Integer(FloatN n)
+			{
+				return _mm512_castsi512_ps(_mm512_cvttps_epi32(
+					_mm512_mul_ps(_mm512_add_ps(n.v, _mm512_set1_ps(127.0f)), _mm512_set1_ps(8388608.0f))));
+			}
+
+			friend FloatN SplitExponent(FloatN a, FloatN& exponent)
+			{
+				const __m512i bits = _mm512_castps_si512(a.v);
+				const __m512 biased = _mm512_cvtepi32_ps(_mm512_and_si512(bits, _mm512_set1_epi32(0x7f800000)));
+				exponent = _mm512_fmadd_ps(biased, _mm512_set1_ps(1.0f / 8388608.0f), _mm512_set1_ps(-127.0f));
+				return _mm512_castsi512_ps(_mm512_or_si512(
+					_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)), _mm512_set1_epi32(0x3f800000)));
+			}
+		};
+
+#elif QMATH_AVX
+
+		struct FloatN
+		{
+			__m256 v;
+
+			FloatN() = default;
+			FloatN(__m256 v) : v(v) {}
+			explicit FloatN(float value) : v(_mm256_set1_ps(value)) {}
+
+			static FloatN Load(const float* values) { return _mm256_loadu_ps(values); }
+			void Store(float* values) const { _mm256_storeu_ps(values, v); }
+
+			static void LoadInterleaved4(const float* values, FloatN& a, FloatN& b, FloatN& c, FloatN& d)
+			{
+				const __m256 v0 = _mm256_loadu_ps(values),		v1 = _mm256_loadu_ps(values + 8);
+				const __m256 v2 = _mm256_loadu_ps(values + 16),	v3 = _mm256_loadu_ps(values + 24);
+
+				// Pair groups i and i + 4 across the 128-bit halves, then transpose within halves
+				const __m256 r0 = _mm256_permute2f128_ps(v0, v2, 0x20);
+				const __m256 r1 = _mm256_permute2f128_ps(v0, v2, 0x31);
+				const __m256 r2 = _mm256_permute2f128_ps(v1, v3, 0x20);
+				const __m256 r3 = _mm256_permute2f128_ps(v1, v3, 0x31);
+
+				const __m256 t0 = _mm256_unpacklo_ps(r0, r1), t1 = _mm256_unpackhi_ps(r0, r1);
+				const __m256 t2 = _mm256_unpacklo_ps(r2, r3), t3 = _mm256_unpackhi_ps(r2, r3);
+
+				a = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+				b = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+				c = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+				d = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+			}
+
+			friend FloatN operator+(FloatN a, FloatN b) { return _mm256_add_ps(a.v, b.v); }
+			friend FloatN operator-(FloatN a, FloatN b) { return _mm256_sub_ps(a.v, b.v); }
+			friend FloatN operator*(FloatN a, FloatN b) { return _mm256_mul_ps(a.v, b.v); }
+			friend FloatN operator/(FloatN a, FloatN b) { return _mm256_div_ps(a.v, b.v); }
+
+		#if QMATH_FMA
+			friend FloatN MulAdd(FloatN a, FloatN b, FloatN c) { return _mm256_fmadd_ps(a.v, b.v, c.v); }
+		#else
+			friend FloatN MulAdd(FloatN a, FloatN b, FloatN c) { return _mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v); }
+		#endif
+
+			friend FloatN Min(FloatN a, FloatN b) { return _mm256_min_ps(a.v, b.v); }
+			friend FloatN Max(FloatN a, FloatN b) { return _mm256_max_ps(a.v, b.v); }
+			friend FloatN Sqrt(FloatN a) { return _mm256_sqrt_ps(a.v); }
+			friend FloatN RSqrt(FloatN a) { return _mm256_rsqrt_ps(a.v); }
+
+			friend FloatN Abs(FloatN a) { return _mm256_and_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff))); }
+			friend FloatN Floor(FloatN a) { return _mm256_floor_ps(a.v); }
+			friend FloatN LessThan(FloatN a, FloatN b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+			friend FloatN Select(FloatN mask, FloatN a, FloatN b) { return _mm256_blendv_ps(b.v, a.v, mask.v); }
+			friend uInt32 MaskBits(FloatN mask) { return (uInt32)_mm256_movemask_ps(mask.v); }
+
+			// Bit manipulation goes through float conversions, 256-bit integer ops need AVX2
+			friend FloatN Exp2Integer(FloatN n)
+			{
+				return _mm256_castsi256_ps(_mm256_cvttps_epi32(
+					_mm256_mul_ps(_mm256_add_ps(n.v, _mm256_set1_ps(127.0f)), _mm256_set1_ps(8388608.0f))));
+			}
+
+			friend FloatN SplitExponent(FloatN a, FloatN& exponent)
+			{
+				const __m256 biased = _mm256_and_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)));
+				exponent = MulAdd(FloatN(_mm256_cvtepi32_ps(_mm256_castps_si256(biased))),
+					FloatN(1.0f / 8388608.0f), FloatN(-127.0f));
+				return _mm256_or_ps(_mm256_and_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(0x007fffff))),
+					_mm256_castsi256_ps(_mm256_set1_epi32(0x3f800000)));
+			}
+		};
+
+#elif QMATH_SSE2
+
+		struct FloatN
+		{
+			__m128 v;
+
+			FloatN() = default;
+			FloatN(__m128 v) : v(v) {}
+			explicit FloatN(float value) : v(_mm_set1_ps(value)) {}
+
+			static FloatN Load(const float* values) { return _mm_loadu_ps(values); }
+			void Store(float* values) const { _mm_storeu_ps(values, v); }
+
+			static void LoadInterleaved4(const float* values, FloatN& a, FloatN& b, FloatN& c, FloatN& d)
+			{
+				__m128 v0 = _mm_loadu_ps(values),		v1 = _mm_loadu_ps(values + 4);
+				__m128 v2 = _mm_loadu_ps(values + 8),	v3 = _mm_loadu_ps(values + 12);
+
+				_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+
+				a = v0; b = v1; c = v2; d = v3;
+			}
+
+			friend FloatN operator+(FloatN a, FloatN b) { return _mm_add_ps(a.v, b.v); }
+			friend FloatN operator-(FloatN a, FloatN b) { return _mm_sub_ps(a.v, b.v); }
+			friend FloatN operator*(FloatN a, FloatN b) { return _mm_mul_ps(a.v, b.v); }
+			friend FloatN operator/(FloatN a, FloatN b) { return _mm_div_ps(a.v, b.v); }
+
+			friend FloatN MulAdd(FloatN a, FloatN b, FloatN c) { return MulAdd4(a.v, b.v, c.v); }
+			friend FloatN Min(FloatN a, FloatN b) { return _mm_min_ps(a.v, b.v); }
+			friend FloatN Max(FloatN a, FloatN b) { return _mm_max_ps(a.v, b.v); }
+			friend FloatN Sqrt(FloatN a) { return _mm_sqrt_ps(a.v); }
+			friend FloatN RSqrt(FloatN a) { return _mm_rsqrt_ps(a.v); }
+
+			friend FloatN Abs(FloatN a) { return _mm_and_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff))); }
+
+			// SSE2 has no roundps. Truncate, step down where that rounded up and
+			// keep values of 2^23 and above, which are already integral
+			friend FloatN Floor(FloatN a)
+			{
+				const __m128 truncated	= _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v));
+				const __m128 floored	= _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, a.v), _mm_set1_ps(1.0f)));
+				const __m128 integral	= _mm_cmpge_ps(Abs(a).v, _mm_set1_ps(8388608.0f));
+				return _mm_or_ps(_mm_and_ps(integral, a.v), _mm_andnot_ps(integral, floored));
+			}
+
+			friend FloatN LessThan(FloatN a, FloatN b) { return _mm_cmplt_ps(a.v, b.v); }
+
+			friend FloatN Select(FloatN mask, FloatN a, FloatN b)
+			{
+				return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v));
+			}
+
+			friend uInt32 MaskBits(FloatN mask) { return (uInt32)_mm_movemask_ps(mask.v); }
+
+			friend FloatN Exp2Integer(FloatN n)
+			{
+				return _mm_castsi128_ps(_mm_cvttps_epi32(
+					_mm_mul_ps(_mm_add_ps(n.v, _mm_set1_ps(127.0f)), _mm_set1_ps(8388608.0f))));
+			}
+
+			friend FloatN SplitExponent(FloatN a, FloatN& exponent)
+			{
+				const __m128 biased = _mm_and_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(0x7f800000)));
+				exponent = MulAdd(FloatN(_mm_cvtepi32_ps(_mm_castps_si128(biased))),
+					FloatN(1.0f / 8388608.0f), FloatN(-127.0f));
+				return _mm_or_ps(_mm_and_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(0x007fffff))),
+					_mm_castsi128_ps(_mm_set1_epi32(0x3f800000)));
+			}
+		};
+
+#else
+
+		struct FloatN
+		{
+			float v;
+
+			FloatN() = default;
+			explicit FloatN(float value) : v(value) {}
+
+			static FloatN Load(const float* values) { return FloatN(*values); }
+			void Store(float* values) const { *values = v; }
+
+			static void LoadInterleaved4(const float* values, FloatN& a, FloatN& b, FloatN& c, FloatN& d)
+			{
+				a.v = values[0]; b.v = values[1]; c.v = values[2]; d.v = values[3];
+			}
+
+			friend FloatN operator+(FloatN a, FloatN b) { return FloatN(a.v + b.v); }
+			friend FloatN operator-(FloatN a, FloatN b) { return FloatN(a.v - b.v); }
+			friend FloatN operator*(FloatN a, FloatN b) { return FloatN(a.v * b.v); }
+			friend FloatN operator/(FloatN a, FloatN b) { return FloatN(a.v / b.v); }
+
+			friend FloatN MulAdd(FloatN a, FloatN b, FloatN c) { return FloatN(a.v * b.v + c.v); }
+			friend FloatN Min(FloatN a, FloatN b) { return FloatN(a.v < b.v ? a.v : b.v); }
+			friend FloatN Max(FloatN a, FloatN b) { return FloatN(a.v > b.v ? a.v : b.v); }
+			friend FloatN Sqrt(FloatN a) { return FloatN(sqrtf(a.v)); }
+			friend FloatN RSqrt(FloatN a) { return FloatN(1.0f / sqrtf(a.v)); }
+
+			friend FloatN Abs(FloatN a) { return FloatN(fabsf(a.v)); }
+			friend FloatN Floor(FloatN a) { return FloatN(floorf(a.v)); }
+			friend FloatN LessThan(FloatN a, FloatN b) { return FloatN(a.v < b.v ? 1.0f : 0.0f); }
+			friend FloatN Select(FloatN mask, FloatN a, FloatN b) { return mask.v != 0.0f ? a : b; }
+			friend uInt32 MaskBits(FloatN mask) { return mask.v != 0.0f ? 1u : 0u; }
+			friend FloatN Exp2Integer(FloatN n) { return FloatN(Exp2Integer(n.v)); }
+			friend FloatN SplitExponent(FloatN a, FloatN& exponent) { return FloatN(SplitExponent(a.v, exponent.v)); }
+		};
+
+#endif
+	}
+}
@@ -3,6 +3,7 @@
 #include "Vector.h"
 #include "Quaternion.h"
 #include "Matrix.h"
+#include "Affine.h"
 
 namespace Quartz
 {
@@ -78,10 +79,12 @@ namespace Quartz
 
 		inline Mat4f GetMatrix() const
 		{
-			return
-				Mat4f().SetScale(scale) *
-				Mat4f().SetRotation(rotation) *
-				Mat4f().SetTranslation(position);
+			return Mat4f().SetTRS(position, rotation, scale);
+		}
+
+		inline Affine3f GetAffine() const
+		{
+			return Affine3f().SetTRS(position, rotation, scale);
 		}
 
 		inline Mat4f GetViewMatrix() const
@@ -0,0 +1,216 @@
+#pragma once
+
+#include "Transform.h"
+#include "Affine.h"
+#include "Batch.h"
+
+#include <vector>
+
+namespace Quartz
+{
+	/*====================================================
+	|            QUARTZMATH TRANSFORM HIERARCHY          |
+	=====================================================*/
+
+	// TransformHierarchy stores a scene graph as flat arrays indexed by node:
+	// local Transforms, parent indices, cached local and world matrices and a
+	// dirty flag byte. Nodes are topologically sorted, a parent is always
+	// added before its children (parents[i] < i), so one forward pass sees
+	// every parent before its children.
+	//
+	// Setting a local transform only marks the node. Update() then scans from
+	// the first marked node, propagating world dirtiness from parents to
+	// children, recomposes the changed local matrices in one SIMD batch
+	// (ComposeAffine) and multiplies world = local * parentWorld for the
+	// dirty subtrees only. Clean nodes cost one flag and parent check, and
+	// nothing at all before the first marked node.
+
+	struct TransformHierarchy
+	{
+		static constexpr uInt32 NO_PARENT = 0xFFFFFFFFu;
+
+		static constexpr uInt8 LOCAL_DIRTY = 1;		// Local transform changed
+		static constexpr uInt8 WORLD_DIRTY = 2;		// Local or an ancestor changed
+
+		std::vector<Transform>	locals;
+		std::vector<uInt32>		parents;
+		std::vector<Affine3f>	localMatrices;
+		std::vector<Affine3f>	worldMatrices;
+		std::vector<uInt8>		flags;
+
+		uSize firstDirty;
+
+		// Update() scratch, kept to avoid reallocating every frame
+		std::vector<uInt32> composeList;
+		std::vector<uInt32> updateList;
+
+		/** Construct an empty TransformHierarchy */
+		TransformHierarchy() :
+			firstDirty(0) { }
+
+		/** Number of nodes */
+		uSize Size() const
+		{
+			return locals.size();
+		}
+
+		/** Reserve space for count nodes */
+		void Reserve(uSize count)
+		{
+			locals.reserve(count);
+			parents.reserve(count);
+			localMatrices.reserve(count);
+			worldMatrices.reserve(count);
+			flags.reserve(count);
+		}
+
+		/** Remove all nodes */
+		void Clear()
+		{
+			locals.clear();
+			parents.clear();
+			localMatrices.clear();
+			worldMatrices.clear();
+			flags.clear();
+			firstDirty = 0;
+		}
+
+		/** Add a node under parent and return its index. A parent that is not an existing node adds a root */
+		uInt32 Add(const Transform& local, uInt32 parent = NO_PARENT)
+		{
+			const uInt32 index = (uInt32)locals.size();
+
+			locals.push_back(local);
+			parents.push_back(parent < index ? parent : NO_PARENT);
+			localMatrices.emplace_back();
+			worldMatrices.emplace_back();
+			flags.push_back(LOCAL_DIRTY | WORLD_DIRTY);
+
+			firstDirty = Min<uSize>(firstDirty, index);
+
+			return index;
+		}
+
+		/** Get the parent index of a node, NO_PARENT for roots */
+		uInt32 GetParent(uInt32 index) const
+		{
+			return parents[index];
+		}
+
+		/** Get the local transform of a node */
+		const Transform& GetLocal(uInt32 index) const
+		{
+			return locals[index];
+		}
+
+		/** Set the local transform of a node */
+		void SetLocal(uInt32 index, const Transform& local)
+		{
+			locals[index] = local;
+			MarkDirty(index);
+		}
+
+		/** Set the local position of a node */
+		void SetPosition(uInt32 index, const Vec3f& position)
+		{
+			locals[index].position = position;
+			MarkDirty(index);
+		}
+
+		/** Set the local rotation of a node */
+		void SetRotation(uInt32 index, const Quatf& rotation)
+		{
+			locals[index].rotation = rotation;
+			MarkDirty(index);
+		}
+
+		/** Set the local scale of a node */
+		void SetScale(uInt32 index, const Vec3f& scale)
+		{
+			locals[index].scale = scale;
+			MarkDirty(index);
+		}
+
+		/** Mark a node's local transform as changed, after editing locals directly */
+		void MarkDirty(uInt32 index)
+		{
+			flags[index] |= LOCAL_DIRTY | WORLD_DIRTY;
+			firstDirty = Min<uSize>(firstDirty, index);
+		}
+
+		/** Check if a node's world matrix is out of date */
+		bool IsDirty(uInt32 index) const
+		{
+			return flags[index] != 0;
+		}
+
+		/** Get the local matrix of a node, valid after Update() */
+		const Affine3f& GetLocalMatrix(uInt32 index) const
+		{
+			return localMatrices[index];
+		}
+
+		/** Get the world matrix of a node, valid after Update() */
+		const Affine3f& GetWorldMatrix(uInt32 index) const
+		{
+			return worldMatrices[index];
+		}
+
+		/** Recompute the local and world matrices of all changed nodes and their descendants */
+		void Update()
+		{
+			const uSize count = Size();
+
+			if (firstDirty >= count)
+			{
+				return;
+			}
+
+			composeList.clear();
+			updateList.clear();
+
+			// Parents precede children, so their flags are final when a child is reached
+			for (uSize i = firstDirty; i < count; i++)
+			{
+				const uInt32 parent = parents[i];
+				uInt8 flag = flags[i];
+
+				if (parent != NO_PARENT && (flags[parent] & WORLD_DIRTY))
+				{
+					flag |= WORLD_DIRTY;
+					flags[i] = flag;
+				}
+
+				if (flag)
+				{
+					if (flag & LOCAL_DIRTY)
+					{
+						composeList.push_back((uInt32)i);
+					}
+
+					updateList.push_back((uInt32)i);
+				}
+			}
+
+			ComposeAffine(locals.data(), composeList.data(), localMatrices.data(), composeList.size());
+
+			for (uInt32 index : updateList)
+			{
+				const uInt32 parent = parents[index];
+
+				if (parent == NO_PARENT)
+				{
+					worldMatrices[index] = localMatrices[index];
+				}
+				else
+				{
+					worldMatrices[index] = localMatrices[index] * worldMatrices[parent];
+				}
+
+				flags[index] = 0;
+			}
+
+			firstDirty = count;
+		}
+	};
+}
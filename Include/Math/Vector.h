@@ -2,6 +2,7 @@
 
 #include "Types.h"
 #include "Util.h"
+#include "Simd.h"
 
 namespace Quartz
 {
@@ -58,27 +59,31 @@ namespace Quartz
 		}
 
 		/** Get the magnitude this of vector */
+		template<Precision precision = Precision::Fast>
 		IntType Magnitude() const
 		{
-			return 1.0f / InverseMagnitudeF();
+			return MagnitudeF<precision>();
 		}
 
 		/** Get the magnitude this of vector as a floating point */
+		template<Precision precision = Precision::Fast>
 		float MagnitudeF() const
 		{
-			return 1.0f / InverseMagnitudeF();
+			return SquareRoot<precision>((float)MagnitudeSquared());
 		}
 
 		/** Get the inverse of the magnitude this of vector */
+		template<Precision precision = Precision::Fast>
 		IntType InverseMagnitude() const
 		{
-			return FastInvsereSquare((float)MagnitudeSquared());
+			return InverseSqrt<precision>((float)MagnitudeSquared());
 		}
 
 		/** Get the inverse of the magnitude this of vector as a floating point */
+		template<Precision precision = Precision::Fast>
 		float InverseMagnitudeF() const
 		{
-			return FastInvsereSquare((float)MagnitudeSquared());
+			return InverseSqrt<precision>((float)MagnitudeSquared());
 		}
 
 		/** Get the squared magnitude of this vector */
@@ -88,19 +93,21 @@ namespace Quartz
 		}
 
 		/** Normalize this vector */
+		template<Precision precision = Precision::Fast>
 		Vector2& Normalize()
 		{
-			IntType inverse = InverseMagnitude();
+			IntType inverse = InverseMagnitude<precision>();
 			this->x *= inverse;
 			this->y *= inverse;
 			return *this;
 		}
 
 		/** Get the normalized vector */
+		template<Precision precision = Precision::Fast>
 		Vector2 Normalized() const
 		{
 			Vector2 result;
-			IntType inverse = InverseMagnitude();
+			IntType inverse = InverseMagnitude<precision>();
 			result.x = x * inverse;
 			result.y = y * inverse;
 			return result;
@@ -346,15 +353,17 @@ namespace Quartz
 		}
 
 		/** Get the magnitude of this vector */
+		template<Precision precision = Precision::Fast>
 		constexpr IntType Magnitude() const
 		{
-			return 1.0f / FastInvsereSquare(MagnitudeSquared());
+			return SquareRoot<precision>(MagnitudeSquared());
 		}
 
-		/** Get the magnitude of this vector */
+		/** Get the inverse of the magnitude of this vector */
+		template<Precision precision = Precision::Fast>
 		constexpr IntType InverseMagnitude() const
 		{
-			return FastInvsereSquare(MagnitudeSquared());
+			return InverseSqrt<precision>(MagnitudeSquared());
 		}
 
 		/** Get the squared magnitude of this vector */
@@ -364,9 +373,10 @@ namespace Quartz
 		}
 
 		/** Normalize this vector */
+		template<Precision precision = Precision::Fast>
 		constexpr Vector3& Normalize()
 		{
-			IntType inverse = InverseMagnitude();
+			IntType inverse = InverseMagnitude<precision>();
 			this->x *= inverse;
 			this->y *= inverse;
 			this->z *= inverse;
@@ -374,10 +384,11 @@ namespace Quartz
 		}
 
 		/** Get the normalized vector */
+		template<Precision precision = Precision::Fast>
 		constexpr Vector3 Normalized() const
 		{
 			Vector3 result;
-			IntType inverse = InverseMagnitude();
+			IntType inverse = InverseMagnitude<precision>();
 			result.x = x * inverse;
 			result.y = y * inverse;
 			result.z = z * inverse;
@@ -640,6 +651,10 @@ namespace Quartz
 		constexpr Vector4(const Vector3<IntType>& vec3, float w)
 			: x(vec3.x), y(vec3.y), z(vec3.z), w(w) { }
 
+		template<typename OIntType>
+		constexpr Vector4(const Vector4<OIntType>& vec4)
+			: x(vec4.x), y(vec4.y), z(vec4.z), w(vec4.w) { }
+
 		constexpr Vector4(const Vector4& vec4)
 			: x(vec4.x), y(vec4.y), z(vec4.z), w(vec4.w) { }
 
@@ -662,15 +677,17 @@ namespace Quartz
 		}
 
 		/** Get the magnitude of this vector */
+		template<Precision precision = Precision::Fast>
 		IntType Magnitude() const
 		{
-			return 1.0f / FastInvsereSquare(MagnitudeSquared());
+			return SquareRoot<precision>(MagnitudeSquared());
 		}
 
-		/** Get the magnitude of this vector */
+		/** Get the inverse of the magnitude of this vector */
+		template<Precision precision = Precision::Fast>
 		IntType InverseMagnitude() const
 		{
-			return FastInvsereSquare(MagnitudeSquared());
+			return InverseSqrt<precision>(MagnitudeSquared());
 		}
 
 		/** Get the squared magnitude of this vector */
@@ -680,9 +697,10 @@ namespace Quartz
 		}
 
 		/** Normalize this vector */
+		template<Precision precision = Precision::Fast>
 		Vector4& Normalize()
 		{
-			IntType inverse = InverseMagnitude();
+			IntType inverse = InverseMagnitude<precision>();
 			this->x *= inverse;
 			this->y *= inverse;
 			this->z *= inverse;
@@ -691,10 +709,11 @@ namespace Quartz
 		}
 
 		/** Get the normalized vector */
+		template<Precision precision = Precision::Fast>
 		Vector4 Normalized() const
 		{
 			Vector4 result;
-			IntType inverse = InverseMagnitude();
+			IntType inverse = InverseMagnitude<precision>();
 			result.x = x * inverse;
 			result.y = y * inverse;
 			result.z = z * inverse;
@@ -711,7 +730,7 @@ namespace Quartz
 			{
 				if (e[i] > max)
 				{
-					max = value;
+					max = e[i];
 				}
 			}
 
@@ -886,6 +905,152 @@ namespace Quartz
 		}
 	};
 
+#if QMATH_SSE2
+
+	/*====================================================
+	|              QUARTZMATH VECTOR4 (SIMD)             |
+	=====================================================*/
+
+	// Vector4<float> keeps the generic layout and only swaps the bodies
+	// of its arithmetic operators for SSE. Loads and stores are unaligned.
+	// Constant evaluation takes the scalar body, so the operators stay
+	// usable in constant expressions as with SIMD disabled.
+
+	template<>
+	constexpr Vector4<float> Vector4<float>::operator+(const Vector4<float>& vec4) const
+	{
+		if (Simd::IsConstantEvaluated())
+		{
+			return Vector4<float>(x + vec4.x, y + vec4.y, z + vec4.z, w + vec4.w);
+		}
+
+		Vector4<float> result;
+		Simd::Store4(result.e, _mm_add_ps(Simd::Load4(e), Simd::Load4(vec4.e)));
+		return result;
+	}
+
+	template<>
+	constexpr Vector4<float> Vector4<float>::operator-(const Vector4<float>& vec4) const
+	{
+		if (Simd::IsConstantEvaluated())
+		{
+			return Vector4<float>(x - vec4.x, y - vec4.y, z - vec4.z, w - vec4.w);
+		}
+
+		Vector4<float> result;
+		Simd::Store4(result.e, _mm_sub_ps(Simd::Load4(e), Simd::Load4(vec4.e)));
+		return result;
+	}
+
+	template<>
+	constexpr Vector4<float> Vector4<float>::operator*(const Vector4<float>& vec4) const
+	{
+		if (Simd::IsConstantEvaluated())
+		{
+			return Vector4<float>(x * vec4.x, y * vec4.y, z * vec4.z, w * vec4.w);
+		}
+
+		Vector4<float> result;
+		Simd::Store4(result.e, _mm_mul_ps(Simd::Load4(e), Simd::Load4(vec4.e)));
+		return result;
+	}
+
+	template<>
+	constexpr Vector4<float> Vector4<float>::operator/(const Vector4<float>& vec4) const
+	{
+		if (Simd::IsConstantEvaluated())
+		{
+			return Vector4<float>(x / vec4.x, y / vec4.y, z / vec4.z, w / vec4.w);
+		}
+
+		Vector4<float> result;
+		Simd::Store4(result.e, _mm_div_ps(Simd::Load4(e), Simd::Load4(vec4.e)));
+		return result;
+	}
+
+	template<>
+	constexpr Vector4<float> Vector4<float>::operator*(float value) const
+	{
+		if (Simd::IsConstantEvaluated())
+		{
+			return Vector4<float>(x * value, y * value, z * value, w * value);
+		}
+
+		Vector4<float> result;
+		Simd::Store4(result.e, _mm_mul_ps(Simd::Load4(e), _mm_set1_ps(value)));
+		return result;
+	}
+
+	template<>
+	constexpr Vector4<float> Vector4<float>::operator+=(const Vector4<float>& vec4)
+	{
+		if (Simd::IsConstantEvaluated())
+		{
+			x += vec4.x;
+			y += vec4.y;
+			z += vec4.z;
+			w += vec4.w;
+
+			return *this;
+		}
+
+		Simd::Store4(e, _mm_add_ps(Simd::Load4(e), Simd::Load4(vec4.e)));
+		return *this;
+	}
+
+	template<>
+	constexpr Vector4<float> Vector4<float>::operator-=(const Vector4<float>& vec4)
+	{
+		if (Simd::IsConstantEvaluated())
+		{
+			x -= vec4.x;
+			y -= vec4.y;
+			z -= vec4.z;
+			w -= vec4.w;
+
+			return *this;
+		}
+
+		Simd::Store4(e, _mm_sub_ps(Simd::Load4(e), Simd::Load4(vec4.e)));
+		return *this;
+	}
+
+	template<>
+	constexpr Vector4<float> Vector4<float>::operator*=(const Vector4<float>& vec4)
+	{
+		if (Simd::IsConstantEvaluated())
+		{
+			x *= vec4.x;
+			y *= vec4.y;
+			z *= vec4.z;
+			w *= vec4.w;
+
+			return *this;
+		}
+
+		Simd::Store4(e, _mm_mul_ps(Simd::Load4(e), Simd::Load4(vec4.e)));
+		return *this;
+	}
+
+	template<>
+	constexpr Vector4<float> Vector4<float>::operator*=(float value)
+	{
+		if (Simd::IsConstantEvaluated())
+		{
+			x *= value;
+			y *= value;
+			z *= value;
+			w *= value;
+
+			return *this;
+		}
+
+		Simd::Store4(e, _mm_mul_ps(Simd::Load4(e), _mm_set1_ps(value)));
+		return *this;
+	}
+
+#endif // QMATH_SSE2
+
 	template<typename IntType>
 	constexpr const Vector3<IntType> Vector3<IntType>::ZERO		= Vector3<IntType>(0, 0, 0);
 
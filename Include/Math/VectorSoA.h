@@ -0,0 +1,701 @@
+#pragma once
+
+#include "Simd.h"
+#include "Vector.h"
+#include "Matrix.h"
+
+#include <new>
+#include <vector>
+#include <cstring>
+
+namespace Quartz
+{
+	/*====================================================
+	|                QUARTZMATH SOA STORAGE              |
+	=====================================================*/
+
+	/** Round a count up to the batch padding width */
+	constexpr uSize SoAPaddedCount(uSize count)
+	{
+		return (count + QMATH_SIMD_MAX_WIDTH - 1) & ~(uSize)(QMATH_SIMD_MAX_WIDTH - 1);
+	}
+
+	/** Allocate zeroed lane storage aligned for batch kernels */
+	inline float* SoAAllocate(uSize count)
+	{
+		if (count == 0)
+		{
+			return nullptr;
+		}
+
+		float* lanes = static_cast<float*>(
+			::operator new(count * sizeof(float), std::align_val_t(QMATH_SIMD_ALIGNMENT)));
+		memset(lanes, 0, count * sizeof(float));
+
+		return lanes;
+	}
+
+	/** Free lane storage allocated with SoAAllocate */
+	inline void SoAFree(float* lanes)
+	{
+		if (lanes)
+		{
+			::operator delete(lanes, std::align_val_t(QMATH_SIMD_ALIGNMENT));
+		}
+	}
+
+	/*====================================================
+	|                 QUARTZMATH VEC3F SOA               |
+	=====================================================*/
+
+	// Vec3fSoA stores each component in its own lane array. All lanes share a
+	// single allocation aligned to QMATH_SIMD_ALIGNMENT and padded to a multiple
+	// of QMATH_SIMD_MAX_WIDTH, so kernels never need a scalar tail. The contents
+	// of the padding past Size() are unspecified.
+
+	struct Vec3fSoA
+	{
+		float* x;
+		float* y;
+		float* z;
+
+		uSize size;
+		uSize capacity;
+
+		/** Construct an empty Vec3fSoA */
+		Vec3fSoA()
+			: x(nullptr), y(nullptr), z(nullptr), size(0), capacity(0) { }
+
+		/** Construct a zeroed Vec3fSoA of count vectors */
+		explicit Vec3fSoA(uSize count)
+			: Vec3fSoA()
+		{
+			Resize(count);
+		}
+
+		/** Construct a Vec3fSoA from an array of vectors */
+		Vec3fSoA(const Vec3f* vectors, uSize count)
+			: Vec3fSoA()
+		{
+			FromAoS(vectors, count);
+		}
+
+		/** Construct a Vec3fSoA from a vector of vectors */
+		explicit Vec3fSoA(const std::vector<Vec3f>& vectors)
+			: Vec3fSoA(vectors.data(), (uSize)vectors.size()) { }
+
+		Vec3fSoA(const Vec3fSoA& soa)
+			: Vec3fSoA()
+		{
+			Resize(soa.size);
+			memcpy(x, soa.x, capacity * 3 * sizeof(float));
+		}
+
+		Vec3fSoA(Vec3fSoA&& soa) noexcept
+			: x(soa.x), y(soa.y), z(soa.z), size(soa.size), capacity(soa.capacity)
+		{
+			soa.x = soa.y = soa.z = nullptr;
+			soa.size = soa.capacity = 0;
+		}
+
+		~Vec3fSoA()
+		{
+			SoAFree(x);
+		}
+
+		Vec3fSoA& operator=(const Vec3fSoA& soa)
+		{
+			if (this != &soa)
+			{
+				Resize(soa.size);
+				memcpy(x, soa.x, capacity * 3 * sizeof(float));
+			}
+
+			return *this;
+		}
+
+		Vec3fSoA& operator=(Vec3fSoA&& soa) noexcept
+		{
+			if (this != &soa)
+			{
+				SoAFree(x);
+				x = soa.x; y = soa.y; z = soa.z;
+				size = soa.size; capacity = soa.capacity;
+				soa.x = soa.y = soa.z = nullptr;
+				soa.size = soa.capacity = 0;
+			}
+
+			return *this;
+		}
+
+		/** Resize to count vectors, new vectors are zeroed */
+		void Resize(uSize count)
+		{
+			uSize padded = SoAPaddedCount(count);
+
+			if (padded != capacity)
+			{
+				float* lanes = SoAAllocate(padded * 3);
+				uSize keep = Min(size, count);
+
+				if (keep > 0)
+				{
+					memcpy(lanes,				x, keep * sizeof(float));
+					memcpy(lanes + padded,		y, keep * sizeof(float));
+					memcpy(lanes + padded * 2,	z, keep * sizeof(float));
+				}
+
+				SoAFree(x);
+
+				x = lanes;
+				y = lanes ? lanes + padded : nullptr;
+				z = lanes ? lanes + padded * 2 : nullptr;
+				capacity = padded;
+			}
+			else if (count > size)
+			{
+				memset(x + size, 0, (count - size) * sizeof(float));
+				memset(y + size, 0, (count - size) * sizeof(float));
+				memset(z + size, 0, (count - size) * sizeof(float));
+			}
+
+			size = count;
+		}
+
+		/** Get the number of vectors */
+		uSize Size() const
+		{
+			return size;
+		}
+
+		/** Get the number of vectors including padding */
+		uSize PaddedSize() const
+		{
+			return capacity;
+		}
+
+		/** Get a vector by index */
+		Vec3f Get(uSize index) const
+		{
+			return Vec3f(x[index], y[index], z[index]);
+		}
+
+		/** Set a vector by index */
+		void Set(uSize index, const Vec3f& vec3)
+		{
+			x[index] = vec3.x;
+			y[index] = vec3.y;
+			z[index] = vec3.z;
+		}
+
+		/** Fill from an array of vectors */
+		void FromAoS(const Vec3f* vectors, uSize count)
+		{
+			Resize(count);
+
+			for (uSize i = 0; i < count; i++)
+			{
+				x[i] = vectors[i].x;
+				y[i] = vectors[i].y;
+				z[i] = vectors[i].z;
+			}
+		}
+
+		/** Copy into an array of Size() vectors */
+		void ToAoS(Vec3f* vectors) const
+		{
+			for (uSize i = 0; i < size; i++)
+			{
+				vectors[i].x = x[i];
+				vectors[i].y = y[i];
+				vectors[i].z = z[i];
+			}
+		}
+
+		/** Copy into a vector of vectors */
+		std::vector<Vec3f> ToVector() const
+		{
+			std::vector<Vec3f> vectors(size);
+			ToAoS(vectors.data());
+			return vectors;
+		}
+	};
+
+	/*====================================================
+	|                 QUARTZMATH VEC4F SOA               |
+	=====================================================*/
+
+	// Vec4fSoA follows the same storage rules as Vec3fSoA with a fourth lane.
+
+	struct Vec4fSoA
+	{
+		float* x;
+		float* y;
+		float* z;
+		float* w;
+
+		uSize size;
+		uSize capacity;
+
+		/** Construct an empty Vec4fSoA */
+		Vec4fSoA()
+			: x(nullptr), y(nullptr), z(nullptr), w(nullptr), size(0), capacity(0) { }
+
+		/** Construct a zeroed Vec4fSoA of count vectors */
+		explicit Vec4fSoA(uSize count)
+			: Vec4fSoA()
+		{
+			Resize(count);
+		}
+
+		/** Construct a Vec4fSoA from an array of vectors */
+		Vec4fSoA(const Vec4f* vectors, uSize count)
+			: Vec4fSoA()
+		{
+			FromAoS(vectors, count);
+		}
+
+		/** Construct a Vec4fSoA from a vector of vectors */
+		explicit Vec4fSoA(const std::vector<Vec4f>& vectors)
+			: Vec4fSoA(vectors.data(), (uSize)vectors.size()) { }
+
+		Vec4fSoA(const Vec4fSoA& soa)
+			: Vec4fSoA()
+		{
+			Resize(soa.size);
+			memcpy(x, soa.x, capacity * 4 * sizeof(float));
+		}
+
+		Vec4fSoA(Vec4fSoA&& soa) noexcept
+			: x(soa.x), y(soa.y), z(soa.z), w(soa.w), size(soa.size), capacity(soa.capacity)
+		{
+			soa.x = soa.y = soa.z = soa.w = nullptr;
+			soa.size = soa.capacity = 0;
+		}
+
+		~Vec4fSoA()
+		{
+			SoAFree(x);
+		}
+
+		Vec4fSoA& operator=(const Vec4fSoA& soa)
+		{
+			if (this != &soa)
+			{
+				Resize(soa.size);
+				memcpy(x, soa.x, capacity * 4 * sizeof(float));
+			}
+
+			return *this;
+		}
+
+		Vec4fSoA& operator=(Vec4fSoA&& soa) noexcept
+		{
+			if (this != &soa)
+			{
+				SoAFree(x);
+				x = soa.x; y = soa.y; z = soa.z; w = soa.w;
+				size = soa.size; capacity = soa.capacity;
+				soa.x = soa.y = soa.z = soa.w = nullptr;
+				soa.size = soa.capacity = 0;
+			}
+
+			return *this;
+		}
+
+		/** Resize to count vectors, new vectors are zeroed */
+		void Resize(uSize count)
+		{
+			uSize padded = SoAPaddedCount(count);
+
+			if (padded != capacity)
+			{
+				float* lanes = SoAAllocate(padded * 4);
+				uSize keep = Min(size, count);
+
+				if (keep > 0)
+				{
+					memcpy(lanes,				x, keep * sizeof(float));
+					memcpy(lanes + padded,		y, keep * sizeof(float));
+					memcpy(lanes + padded * 2,	z, keep * sizeof(float));
+					memcpy(lanes + padded * 3,	w, keep * sizeof(float));
+				}
+
+				SoAFree(x);
+
+				x = lanes;
+				y = lanes ? lanes + padded : nullptr;
+				z = lanes ? lanes + padded * 2 : nullptr;
+				w = lanes ? lanes + padded * 3 : nullptr;
+				capacity = padded;
+			}
+			else if (count > size)
+			{
+				memset(x + size, 0, (count - size) * sizeof(float));
+				memset(y + size, 0, (count - size) * sizeof(float));
+				memset(z + size, 0, (count - size) * sizeof(float));
+				memset(w + size, 0, (count - size) * sizeof(float));
+			}
+
+			size = count;
+		}
+
+		/** Get the number of vectors */
+		uSize Size() const
+		{
+			return size;
+		}
+
+		/** Get the number of vectors including padding */
+		uSize PaddedSize() const
+		{
+			return capacity;
+		}
+
+		/** Get a vector by index */
+		Vec4f Get(uSize index) const
+		{
+			return Vec4f(x[index], y[index], z[index], w[index]);
+		}
+
+		/** Set a vector by index */
+		void Set(uSize index, const Vec4f& vec4)
+		{
+			x[index] = vec4.x;
+			y[index] = vec4.y;
+			z[index] = vec4.z;
+			w[index] = vec4.w;
+		}
+
+		/** Fill from an array of vectors */
+		void FromAoS(const Vec4f* vectors, uSize count)
+		{
+			Resize(count);
+
+			for (uSize i = 0; i < count; i++)
+			{
+				x[i] = vectors[i].x;
+				y[i] = vectors[i].y;
+				z[i] = vectors[i].z;
+				w[i] = vectors[i].w;
+			}
+		}
+
+		/** Copy into an array of Size() vectors */
+		void ToAoS(Vec4f* vectors) const
+		{
+			for (uSize i = 0; i < size; i++)
+			{
+				vectors[i].x = x[i];
+				vectors[i].y = y[i];
+				vectors[i].z = z[i];
+				vectors[i].w = w[i];
+			}
+		}
+
+		/** Copy into a vector of vectors */
+		std::vector<Vec4f> ToVector() const
+		{
+			std::vector<Vec4f> vectors(size);
+			ToAoS(vectors.data());
+			return vectors;
+		}
+	};
+
+	/*====================================================
+	|                QUARTZMATH SOA KERNELS              |
+	=====================================================*/
+
+	// Kernels resize their output to the size of their input and run over the
+	// full padded range. Kernels taking two inputs run over the shorter of the
+	// two so a smaller second input is never read past its end. Outputs may
+	// alias inputs.
+
+	/** out = veca + vecb */
+	inline void Add(const Vec3fSoA& veca, const Vec3fSoA& vecb, Vec3fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(Min(veca.size, vecb.size));
+
+		for (uSize i = 0; i < out.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			(FloatN::Load(veca.x + i) + FloatN::Load(vecb.x + i)).Store(out.x + i);
+			(FloatN::Load(veca.y + i) + FloatN::Load(vecb.y + i)).Store(out.y + i);
+			(FloatN::Load(veca.z + i) + FloatN::Load(vecb.z + i)).Store(out.z + i);
+		}
+	}
+
+	/** out = veca + vecb */
+	inline void Add(const Vec4fSoA& veca, const Vec4fSoA& vecb, Vec4fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(Min(veca.size, vecb.size));
+
+		for (uSize i = 0; i < out.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			(FloatN::Load(veca.x + i) + FloatN::Load(vecb.x + i)).Store(out.x + i);
+			(FloatN::Load(veca.y + i) + FloatN::Load(vecb.y + i)).Store(out.y + i);
+			(FloatN::Load(veca.z + i) + FloatN::Load(vecb.z + i)).Store(out.z + i);
+			(FloatN::Load(veca.w + i) + FloatN::Load(vecb.w + i)).Store(out.w + i);
+		}
+	}
+
+	/** out = vecs * scale */
+	inline void Scale(const Vec3fSoA& vecs, float scale, Vec3fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(vecs.size);
+
+		const FloatN s(scale);
+
+		for (uSize i = 0; i < vecs.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			(FloatN::Load(vecs.x + i) * s).Store(out.x + i);
+			(FloatN::Load(vecs.y + i) * s).Store(out.y + i);
+			(FloatN::Load(vecs.z + i) * s).Store(out.z + i);
+		}
+	}
+
+	/** out = vecs * scale */
+	inline void Scale(const Vec4fSoA& vecs, float scale, Vec4fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(vecs.size);
+
+		const FloatN s(scale);
+
+		for (uSize i = 0; i < vecs.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			(FloatN::Load(vecs.x + i) * s).Store(out.x + i);
+			(FloatN::Load(vecs.y + i) * s).Store(out.y + i);
+			(FloatN::Load(vecs.z + i) * s).Store(out.z + i);
+			(FloatN::Load(vecs.w + i) * s).Store(out.w + i);
+		}
+	}
+
+	/** out[i] = Dot(veca[i], vecb[i]), out must hold PaddedSize() floats of the shorter input */
+	inline void Dot(const Vec3fSoA& veca, const Vec3fSoA& vecb, float* out)
+	{
+		using Simd::FloatN;
+		const uSize padded = SoAPaddedCount(Min(veca.size, vecb.size));
+
+		for (uSize i = 0; i < padded; i += QMATH_SIMD_WIDTH)
+		{
+			FloatN dot = FloatN::Load(veca.x + i) * FloatN::Load(vecb.x + i);
+			dot = MulAdd(FloatN::Load(veca.y + i), FloatN::Load(vecb.y + i), dot);
+			dot = MulAdd(FloatN::Load(veca.z + i), FloatN::Load(vecb.z + i), dot);
+			dot.Store(out + i);
+		}
+	}
+
+	/** out[i] = Dot(veca[i], vecb[i]), out must hold PaddedSize() floats of the shorter input */
+	inline void Dot(const Vec4fSoA& veca, const Vec4fSoA& vecb, float* out)
+	{
+		using Simd::FloatN;
+		const uSize padded = SoAPaddedCount(Min(veca.size, vecb.size));
+
+		for (uSize i = 0; i < padded; i += QMATH_SIMD_WIDTH)
+		{
+			FloatN dot = FloatN::Load(veca.x + i) * FloatN::Load(vecb.x + i);
+			dot = MulAdd(FloatN::Load(veca.y + i), FloatN::Load(vecb.y + i), dot);
+			dot = MulAdd(FloatN::Load(veca.z + i), FloatN::Load(vecb.z + i), dot);
+			dot = MulAdd(FloatN::Load(veca.w + i), FloatN::Load(vecb.w + i), dot);
+			dot.Store(out + i);
+		}
+	}
+
+	/** out = Cross(veca, vecb) */
+	inline void Cross(const Vec3fSoA& veca, const Vec3fSoA& vecb, Vec3fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(Min(veca.size, vecb.size));
+
+		for (uSize i = 0; i < out.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			const FloatN ax = FloatN::Load(veca.x + i);
+			const FloatN ay = FloatN::Load(veca.y + i);
+			const FloatN az = FloatN::Load(veca.z + i);
+			const FloatN bx = FloatN::Load(vecb.x + i);
+			const FloatN by = FloatN::Load(vecb.y + i);
+			const FloatN bz = FloatN::Load(vecb.z + i);
+
+			(ay * bz - az * by).Store(out.x + i);
+			(az * bx - ax * bz).Store(out.y + i);
+			(ax * by - ay * bx).Store(out.z + i);
+		}
+	}
+
+	/** out = vecs.Normalized(), zero vectors stay zero as with the scalar Normalized */
+	inline void Normalize(const Vec3fSoA& vecs, Vec3fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(vecs.size);
+
+		for (uSize i = 0; i < vecs.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			const FloatN x = FloatN::Load(vecs.x + i);
+			const FloatN y = FloatN::Load(vecs.y + i);
+			const FloatN z = FloatN::Load(vecs.z + i);
+
+			const FloatN lengthSquared = MulAdd(z, z, MulAdd(y, y, x * x));
+			const FloatN inverse = Select(LessThan(FloatN(0.0f), lengthSquared),
+				FloatN(1.0f) / Sqrt(lengthSquared), FloatN(0.0f));
+
+			(x * inverse).Store(out.x + i);
+			(y * inverse).Store(out.y + i);
+			(z * inverse).Store(out.z + i);
+		}
+	}
+
+	/** out = vecs.Normalized(), zero vectors stay zero as with the scalar Normalized */
+	inline void Normalize(const Vec4fSoA& vecs, Vec4fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(vecs.size);
+
+		for (uSize i = 0; i < vecs.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			const FloatN x = FloatN::Load(vecs.x + i);
+			const FloatN y = FloatN::Load(vecs.y + i);
+			const FloatN z = FloatN::Load(vecs.z + i);
+			const FloatN w = FloatN::Load(vecs.w + i);
+
+			const FloatN lengthSquared = MulAdd(w, w, MulAdd(z, z, MulAdd(y, y, x * x)));
+			const FloatN inverse = Select(LessThan(FloatN(0.0f), lengthSquared),
+				FloatN(1.0f) / Sqrt(lengthSquared), FloatN(0.0f));
+
+			(x * inverse).Store(out.x + i);
+			(y * inverse).Store(out.y + i);
+			(z * inverse).Store(out.z + i);
+			(w * inverse).Store(out.w + i);
+		}
+	}
+
+	/** out = Min(veca, vecb) per component */
+	inline void Min(const Vec3fSoA& veca, const Vec3fSoA& vecb, Vec3fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(Min(veca.size, vecb.size));
+
+		for (uSize i = 0; i < out.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			Min(FloatN::Load(veca.x + i), FloatN::Load(vecb.x + i)).Store(out.x + i);
+			Min(FloatN::Load(veca.y + i), FloatN::Load(vecb.y + i)).Store(out.y + i);
+			Min(FloatN::Load(veca.z + i), FloatN::Load(vecb.z + i)).Store(out.z + i);
+		}
+	}
+
+	/** out = Min(veca, vecb) per component */
+	inline void Min(const Vec4fSoA& veca, const Vec4fSoA& vecb, Vec4fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(Min(veca.size, vecb.size));
+
+		for (uSize i = 0; i < out.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			Min(FloatN::Load(veca.x + i), FloatN::Load(vecb.x + i)).Store(out.x + i);
+			Min(FloatN::Load(veca.y + i), FloatN::Load(vecb.y + i)).Store(out.y + i);
+			Min(FloatN::Load(veca.z + i), FloatN::Load(vecb.z + i)).Store(out.z + i);
+			Min(FloatN::Load(veca.w + i), FloatN::Load(vecb.w + i)).Store(out.w + i);
+		}
+	}
+
+	/** out = Max(veca, vecb) per component */
+	inline void Max(const Vec3fSoA& veca, const Vec3fSoA& vecb, Vec3fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(Min(veca.size, vecb.size));
+
+		for (uSize i = 0; i < out.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			Max(FloatN::Load(veca.x + i), FloatN::Load(vecb.x + i)).Store(out.x + i);
+			Max(FloatN::Load(veca.y + i), FloatN::Load(vecb.y + i)).Store(out.y + i);
+			Max(FloatN::Load(veca.z + i), FloatN::Load(vecb.z + i)).Store(out.z + i);
+		}
+	}
+
+	/** out = Max(veca, vecb) per component */
+	inline void Max(const Vec4fSoA& veca, const Vec4fSoA& vecb, Vec4fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(Min(veca.size, vecb.size));
+
+		for (uSize i = 0; i < out.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			Max(FloatN::Load(veca.x + i), FloatN::Load(vecb.x + i)).Store(out.x + i);
+			Max(FloatN::Load(veca.y + i), FloatN::Load(vecb.y + i)).Store(out.y + i);
+			Max(FloatN::Load(veca.z + i), FloatN::Load(vecb.z + i)).Store(out.z + i);
+			Max(FloatN::Load(veca.w + i), FloatN::Load(vecb.w + i)).Store(out.w + i);
+		}
+	}
+
+	/** out = mat4 * Vec4f(points, 1).xyz(), same as Matrix4::operator*(Vector3) */
+	inline void TransformPoints(const Mat4f& mat4, const Vec3fSoA& points, Vec3fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(points.size);
+
+		const FloatN m00(mat4.m00), m01(mat4.m01), m02(mat4.m02);
+		const FloatN m10(mat4.m10), m11(mat4.m11), m12(mat4.m12);
+		const FloatN m20(mat4.m20), m21(mat4.m21), m22(mat4.m22);
+		const FloatN m30(mat4.m30), m31(mat4.m31), m32(mat4.m32);
+
+		for (uSize i = 0; i < points.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			const FloatN x = FloatN::Load(points.x + i);
+			const FloatN y = FloatN::Load(points.y + i);
+			const FloatN z = FloatN::Load(points.z + i);
+
+			MulAdd(z, m20, MulAdd(y, m10, MulAdd(x, m00, m30))).Store(out.x + i);
+			MulAdd(z, m21, MulAdd(y, m11, MulAdd(x, m01, m31))).Store(out.y + i);
+			MulAdd(z, m22, MulAdd(y, m12, MulAdd(x, m02, m32))).Store(out.z + i);
+		}
+	}
+
+	/** out = mat4 * Vec4f(directions, 0).xyz() */
+	inline void TransformDirections(const Mat4f& mat4, const Vec3fSoA& directions, Vec3fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(directions.size);
+
+		const FloatN m00(mat4.m00), m01(mat4.m01), m02(mat4.m02);
+		const FloatN m10(mat4.m10), m11(mat4.m11), m12(mat4.m12);
+		const FloatN m20(mat4.m20), m21(mat4.m21), m22(mat4.m22);
+
+		for (uSize i = 0; i < directions.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			const FloatN x = FloatN::Load(directions.x + i);
+			const FloatN y = FloatN::Load(directions.y + i);
+			const FloatN z = FloatN::Load(directions.z + i);
+
+			MulAdd(z, m20, MulAdd(y, m10, x * m00)).Store(out.x + i);
+			MulAdd(z, m21, MulAdd(y, m11, x * m01)).Store(out.y + i);
+			MulAdd(z, m22, MulAdd(y, m12, x * m02)).Store(out.z + i);
+		}
+	}
+
+	/** out = mat4 * vecs */
+	inline void TransformVectors(const Mat4f& mat4, const Vec4fSoA& vecs, Vec4fSoA& out)
+	{
+		using Simd::FloatN;
+		out.Resize(vecs.size);
+
+		const FloatN m00(mat4.m00), m01(mat4.m01), m02(mat4.m02), m03(mat4.m03);
+		const FloatN m10(mat4.m10), m11(mat4.m11), m12(mat4.m12), m13(mat4.m13);
+		const FloatN m20(mat4.m20), m21(mat4.m21), m22(mat4.m22), m23(mat4.m23);
+		const FloatN m30(mat4.m30), m31(mat4.m31), m32(mat4.m32), m33(mat4.m33);
+
+		for (uSize i = 0; i < vecs.capacity; i += QMATH_SIMD_WIDTH)
+		{
+			const FloatN x = FloatN::Load(vecs.x + i);
+			const FloatN y = FloatN::Load(vecs.y + i);
+			const FloatN z = FloatN::Load(vecs.z + i);
+			const FloatN w = FloatN::Load(vecs.w + i);
+
+			MulAdd(w, m30, MulAdd(z, m20, MulAdd(y, m10, x * m00))).Store(out.x + i);
+			MulAdd(w, m31, MulAdd(z, m21, MulAdd(y, m11, x * m01))).Store(out.y + i);
+			MulAdd(w, m32, MulAdd(z, m22, MulAdd(y, m12, x * m02))).Store(out.z + i);
+			MulAdd(w, m33, MulAdd(z, m23, MulAdd(y, m13, x * m03))).Store(out.w + i);
+		}
+	}
+}